@@ -0,0 +1,144 @@
+//Checks that numeric expressions are evaluated without allocating
+//Not part of the interpreter's project, as it has its own main: build it with every source but InterpreterMain.cpp and SymbolMapTest.cpp and run it with no arguments
+//Replaces operator new with one that counts, then runs a stored block of numeric statements many times on each engine
+//Making the scope of a run may allocate, but the statements must not: repeating them in the block must not change the count
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include "Stream.h"
+#include "Tokens.h"
+#include "ParseTree.h"
+#include "Evaluator.h"
+#include "CodePage.h"
+static size_t allocations = 0;
+
+void* operator new(size_t size)
+{
+	++allocations;
+	void* p = malloc(size == 0 ? 1 : size);
+	if (p == nullptr) throw std::bad_alloc();
+	return p;
+}
+
+void operator delete(void* p) noexcept
+{
+	free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+	free(p);
+}
+
+static Token variable(const char* name)
+{
+	Token t = Tokens::lit_var;
+	t.setData(symbols::intern(name));
+	return t;
+}
+
+template<Tokens type, typename T>
+static Token number(T v)
+{
+	Token t = type;
+	t.setData(v);
+	return t;
+}
+
+/**
+* Builds the block
+*	decl x = 2; decl n = 7L; decl f = 1.5f; x = x * 3 + 2.5; n = (n << 2) - n / 2 * 3; f = f * f + (n > 3) + (x >= 8.5); return (x + n + f);
+* with the three assignments repeated, which use every operand type and the operators in several combinations of them
+*/
+static std::vector<ParseTree> block(int repeats)
+{
+	std::vector<ParseTree> b;
+	const auto declare = [&b](const char* name, Token value) {
+		ParseTree& t = b.emplace_back();
+		t.addNode(variable(name), 0);
+		t.addNode(Tokens::kw_decl, 1);
+		t.addNode(value, 0);
+		t.addNode(Tokens::op_eq, 2);
+	};
+	declare("x", number<Tokens::lit_int>(2L));
+	declare("n", number<Tokens::lit_long>(7LL));
+	declare("f", number<Tokens::lit_float>(1.5f));
+	for (int i = 0; i < repeats; ++i) {
+		ParseTree& x = b.emplace_back();
+		x.addNode(variable("x"), 0);
+		x.addNode(variable("x"), 0);
+		x.addNode(number<Tokens::lit_short>((short)3), 0);
+		x.addNode(Tokens::op_mul, 2);
+		x.addNode(number<Tokens::lit_dbl>(2.5), 0);
+		x.addNode(Tokens::op_plus, 2);
+		x.addNode(Tokens::op_eq, 2);
+
+		ParseTree& n = b.emplace_back();
+		n.addNode(variable("n"), 0);
+		n.addNode(variable("n"), 0);
+		n.addNode(number<Tokens::lit_int>(2L), 0);
+		n.addNode(Tokens::op_sh_left, 2);
+		n.addNode(variable("n"), 0);
+		n.addNode(number<Tokens::lit_int>(2L), 0);
+		n.addNode(Tokens::op_div, 2);
+		n.addNode(number<Tokens::lit_int>(3L), 0);
+		n.addNode(Tokens::op_mul, 2);
+		n.addNode(Tokens::op_minus, 2);
+		n.addNode(Tokens::op_eq, 2);
+
+		ParseTree& f = b.emplace_back();
+		f.addNode(variable("f"), 0);
+		f.addNode(variable("f"), 0);
+		f.addNode(variable("f"), 0);
+		f.addNode(Tokens::op_mul, 2);
+		f.addNode(variable("n"), 0);
+		f.addNode(number<Tokens::lit_int>(3L), 0);
+		f.addNode(Tokens::op_gr, 2);
+		f.addNode(Tokens::op_plus, 2);
+		f.addNode(variable("x"), 0);
+		f.addNode(number<Tokens::lit_dbl>(8.5), 0);
+		f.addNode(Tokens::op_gre, 2);
+		f.addNode(Tokens::op_plus, 2);
+		f.addNode(Tokens::op_eq, 2);
+	}
+	ParseTree& r = b.emplace_back();
+	r.addNode(variable("x"), 0);
+	r.addNode(variable("n"), 0);
+	r.addNode(Tokens::op_plus, 2);
+	r.addNode(variable("f"), 0);
+	r.addNode(Tokens::op_plus, 2);
+	r.addNode(Tokens::kw_return, 1);
+	return b;
+}
+
+/**@return the allocations of the runs after the first few*/
+static size_t count(Engine engine, int repeats)
+{
+	Stream out(tmpfile()); //closed with the Stream, so not stdout
+	CodePage code(engine);
+	Evaluator e(out, code);
+	const Token stored = code.add(block(repeats));
+	constexpr int warmup = 10, runs = 1000;
+	for (int i = 0; i < warmup; ++i) code.eval(stored, e);
+	const size_t before = allocations;
+	for (int i = 0; i < runs; ++i) code.eval(stored, e);
+	return allocations - before;
+}
+
+int main()
+{
+	bool passed = true;
+	for (Engine engine : { Engine::bytecode, Engine::closure }) {
+		const char* name = engine == Engine::bytecode ? "bytecode" : "closure";
+		const size_t once = count(engine, 1), many = count(engine, 100);
+		printf("%s: %zu allocations with the statements once, %zu with them 100 times\n", name, once, many);
+		passed = passed && once == many;
+	}
+	if (!passed) {
+		printf("FAILED: numeric expressions allocated\n");
+		return 1;
+	}
+	printf("passed\n");
+	return 0;
+}
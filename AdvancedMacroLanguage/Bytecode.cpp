@@ -0,0 +1,224 @@
+#include "Bytecode.h"
+#include "ParseTree.h"
+#include "Evaluator.h"
+#include "CodePage.h"
+#include "Optimizer.h"
+#include <algorithm>
+#include <span>
+#include <new>
+/**
+* Appends the instructions for a finished tree. Its nodes are already in the order they are evaluated in
+* Leaves are pushed as constants. Every other node evaluates the values of its children
+* The first operand of &&, || and if is followed by a skip over the rest of the operation
+* Operators whose operands have a known type apply the kernel for those types directly
+* @param types    the type of each node, as given by inferTypes
+*/
+static void emit(const FlatTree& tree, const std::vector<Tokens>& types, Chunk& c)
+{
+	size_t depth = 0;
+	std::vector<size_t> skips; //skips of the lazy operations that have not been emitted yet, innermost last
+	std::vector<Tokens> lazyParent(tree.size(), Tokens::invalid); //for the first operand of a lazy operation, the operation
+	for (uint32_t n = 0; n < tree.size(); ++n)
+		if (Evaluator::lazy(tree.types[n]) && tree.childCounts[n] > 1) lazyParent[tree.children[tree.firstChild[n]]] = tree.types[n];
+	for (uint32_t n = 0; n < tree.size(); ++n) {
+		uint32_t children = tree.childCounts[n];
+		if (children == 0 && tree.payloads[n] != FlatTree::noPayload) {
+			c.code.push_back({ OpCode::push, 0, (uint32_t)c.constants.size() });
+			c.constants.push_back(tree.literals[tree.payloads[n]]);
+			c.maxStack = std::max(c.maxStack, ++depth);
+		}
+		else {
+			if (children > UINT16_MAX) throw evaluator_exception("Too many arguments for one operation");
+			const Tokens op = tree.types[n];
+			if (types[n] != Tokens::invalid && children == 2 && operators::hasKernel(op) && op != Tokens::op_eq && !Evaluator::lazy(op)) {
+				const uint32_t* operands = tree.children.data() + tree.firstChild[n];
+				c.code.push_back({ OpCode::apply, 2, (uint32_t)operators::index(op, operators::tag(types[operands[0]]), operators::tag(types[operands[1]])) });
+			}
+			else {
+				c.code.push_back({ OpCode::eval, (uint16_t)children, (uint32_t)op });
+				c.maxStack = std::max(c.maxStack, depth + 1);
+			}
+			depth = depth - children + 1;
+			if (Evaluator::lazy(tree.types[n]) && children > 1) {
+				c.code[skips.back()].operand = (uint32_t)c.code.size();
+				skips.pop_back();
+			}
+		}
+		if (lazyParent[n] != Tokens::invalid) { //jumps past the operation, which sets the target when it is emitted
+			skips.push_back(c.code.size());
+			c.code.push_back({ OpCode::skip, (uint16_t)lazyParent[n], 0 });
+		}
+	}
+}
+
+Chunk compileExpression(ParseTree& tree)
+{
+	Chunk c;
+	const FlatTree& flat = tree.finish();
+	emit(flat, inferTypes(flat), c);
+	return c;
+}
+
+Chunk compileBlock(std::vector<ParseTree>& block)
+{
+	Chunk c;
+	const std::vector<std::vector<Tokens>> types = inferTypes(block);
+	for (size_t s = 0; s < block.size(); ++s) {
+		size_t start = c.code.size();
+		try {
+			const FlatTree& flat = block[s].finish(); //throws for the first incomplete statement, which has no types
+			emit(flat, types[s], c);
+			c.code.push_back({ OpCode::statement, 0, 0 });
+		}
+		catch (evaluator_exception& e) {
+			c.code.resize(start);
+			c.code.push_back({ OpCode::fail, 0, (uint32_t)c.constants.size() });
+			c.constants.push_back(Token(Tokens::lit_str));
+			c.constants.back().setData(e.what());
+			break; //nothing after the failure can run
+		}
+	}
+	return c;
+}
+
+VirtualMachine::VirtualMachine(CodePage& code) : code(code), stack(1 << 12), top(0), runs(0)
+{
+}
+
+Token VirtualMachine::run(const Chunk& c, Evaluator& e)
+{
+	//counts this call as active until it returns. Once none is, nothing refers to the retired stacks
+	struct Run {
+		VirtualMachine& vm;
+		Run(VirtualMachine& vm) : vm(vm) { ++vm.runs; }
+		~Run() { if (--vm.runs == 0) vm.retired.clear(); }
+	} active(*this);
+	const size_t outer = frames.size(), base = top;
+	try {
+		reserve(c.maxStack);
+		frames.push_back({ &c, 0, top, 0, true });
+		while (true) {
+			Frame& f = frames.back();
+			Token result;
+			if (f.ip < f.chunk->code.size()) {
+				const Instruction& i = f.chunk->code[f.ip++];
+				switch (i.op) {
+				case OpCode::push:
+					stack[top++] = f.chunk->constants[i.operand];
+					continue;
+				case OpCode::eval:
+				{
+					size_t args = top - i.argc;
+					stack[top++] = Token((Tokens)i.operand); //above the arguments so nested runs start after it
+					if (enter(args, e)) continue;
+					Token res = e.evaluate(std::span<Token>(stack.data() + args, i.argc + 1));
+					if (res.getType() == Tokens::invalid) throw evaluator_exception(e.getError());
+					stack[args] = std::move(res);
+					top = args + 1;
+					continue;
+				}
+				case OpCode::statement:
+					if (stack[--top].getType() != Tokens::kw_return) continue;
+					result = e.returnValue();
+					break;
+				case OpCode::fail:
+					throw evaluator_exception(std::string(f.chunk->constants[i.operand].getStr()));
+				case OpCode::apply:
+				{
+					Token res = e.apply(operators::table[i.operand], stack[top - 2], stack[top - 1]);
+					if (res.getType() == Tokens::invalid) throw evaluator_exception(e.getError());
+					stack[top - 2] = std::move(res);
+					--top;
+					continue;
+				}
+				case OpCode::skip:
+				{
+					Token res;
+					if (!e.decides(stack[top - 1], (Tokens)i.argc, res)) continue;
+					if (res.getType() == Tokens::invalid) throw evaluator_exception(e.getError());
+					stack[top - 1] = std::move(res);
+					frames.back().ip = i.operand; //deciding may run code that moves the frames
+					continue;
+				}
+				}
+			}
+			else if (top > f.base) result = stack[top - 1];
+			else result = Tokens::sx_void;
+			//leave the frame and give its result to the caller. Nested runs may have moved the frames so f is not used
+			Frame done = frames.back();
+			frames.pop_back();
+			top = done.base;
+			for (int s = 0; s < done.scopes; ++s) e.popScope();
+			if (frames.size() == outer) return result;
+			stack[top++] = done.keepResult ? std::move(result) : Token(Tokens::sx_void);
+		}
+	}
+	catch (...) {
+		for (; frames.size() > outer; frames.pop_back())
+			for (int s = 0; s < frames.back().scopes; ++s) e.popScope();
+		top = base;
+		try {
+			throw;
+		}
+		catch (std::bad_alloc&) { //the frames are unwound, so the script can go on after the error like any other
+			throw evaluator_exception("Out of memory while running code blocks");
+		}
+	}
+}
+
+void VirtualMachine::reserve(size_t count)
+{
+	if (stack.size() - top >= count) return;
+	const size_t size = std::max(stack.size() * 2, top + count);
+	if (runs == 1) {
+		stack.resize(size);
+		return;
+	}
+	//callers may be evaluating operations on the old stack, so its values are copied rather than moved and it is kept until the outermost run returns
+	std::vector<Token> grown;
+	grown.reserve(size);
+	grown.assign(stack.begin(), stack.begin() + top);
+	grown.resize(size);
+	retired.push_back(std::move(stack));
+	stack = std::move(grown);
+}
+
+bool VirtualMachine::enter(size_t args, Evaluator& e)
+{
+	std::span<Token> operands(stack.data() + args, top - args - 1);
+	const Tokens op = stack[top - 1].getType();
+	const Chunk* body;
+	switch (op) {
+	case Tokens::kw_exec:
+	{
+		if (operands.empty()) return false;
+		Token callee = operands[0];
+		if (callee.getType() == Tokens::lit_var || callee.getType() == Tokens::lit_slot || callee.getType() == Tokens::lit_arg) callee = e.evalLit(callee);
+		if ((body = code.chunk(callee)) == nullptr) return false;
+		e.newCall(&body->slots, operands.subspan(1));
+		break;
+	}
+	case Tokens::ct_if:
+		if (operands.size() != 2 || (body = code.chunk(operands[1])) == nullptr) return false;
+		if (!e.isTrue(operands[0])) {
+			top = args;
+			stack[top++] = Tokens::sx_void;
+			return true;
+		}
+		e.newScope(&body->slots);
+		break;
+	default:
+		return false;
+	}
+	top = args;
+	try {
+		if (frames.size() >= maxFrames) throw evaluator_exception("Code blocks nested deeper than " + std::to_string(maxFrames) + " levels");
+		reserve(body->maxStack);
+		frames.push_back({ body, 0, top, 1, op == Tokens::kw_exec });
+	}
+	catch (...) {
+		e.popScope();
+		throw;
+	}
+	return true;
+}
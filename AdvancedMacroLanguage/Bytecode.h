@@ -0,0 +1,91 @@
+#pragma once
+//Compiles parse trees to bytecode and runs it on a stack machine
+//Stored code is compiled once so executing it again does no tree walking
+#include "Tokens.h"
+#include <vector>
+#include <memory>
+#include <stdint.h>
+enum class OpCode : uint8_t {
+	push, //pushes constants[operand]
+	eval, //replaces the top argc values with the result of the operation (Tokens)operand
+	statement, //pops the result of a statement. Leaves the chunk with the returned value if it was a return
+	fail, //throws an evaluator_exception with the message constants[operand]
+	skip, //if the value on top decides the lazy operation (Tokens)argc, replaces it with the result and jumps to operand
+	apply, //replaces the top two values with the result of operators::table[operand], a kernel chosen from the types inferTypes gives them
+};
+struct Instruction {
+	OpCode op;
+	uint16_t argc;
+	uint32_t operand;
+};
+//Compiled form of an expression or a block of statements
+struct Chunk {
+	std::vector<Instruction> code;
+	std::vector<Token> constants;
+	size_t maxStack; //most values on the operand stack at once, including the slot for the operation
+	std::vector<Symbol> slots; //variables of a block bound to slots of its scope. See resolveSlots
+	Chunk() : maxStack(0) {}
+};
+
+/**
+* Compiles a single expression. Running the chunk gives the value of the expression
+* @throw evaluator_exception if the tree is incomplete
+*/
+Chunk compileExpression(class ParseTree& tree) throw(class evaluator_exception);
+
+/**
+* Compiles the statements of a block. Running the chunk gives the value of a return statement or void
+* A statement that is incomplete compiles to a fail instruction so the error is reported when the block runs
+*/
+Chunk compileBlock(std::vector<class ParseTree>& block);
+
+/**
+* Runs chunks on a single operand stack
+* Blocks run by exec and if get a frame on the machine's own stacks rather than a native call, so their nesting is limited to maxFrames rather than by the native stack
+* Chunks run by any other operation (through CodePage::eval) continue on the same stack above the values of the caller
+*/
+class VirtualMachine
+{
+	//Invariant: top <= stack.size(). A stack that operations are being evaluated on is retired rather than freed when it grows
+private:
+	struct Frame {
+		const Chunk* chunk;
+		size_t ip;
+		size_t base; //index of the first value of the frame on the stack
+		int scopes; //scopes of the Evaluator to pop when the frame is left
+		bool keepResult; //false for the body of an if, which gives void
+	};
+	class CodePage& code;
+	std::vector<Token> stack;
+	size_t top; //one past the last value
+	std::vector<Frame> frames;
+	std::vector<std::vector<Token>> retired; //stacks replaced while nested runs were active, which callers may still refer to
+	int runs; //calls of run that have not returned
+public:
+	VirtualMachine(class CodePage& code);
+	VirtualMachine(const VirtualMachine& other) = delete;
+	VirtualMachine& operator=(const VirtualMachine& other) = delete;
+
+	/**
+	* Runs the chunk. The operand stack is left as it was found, even on error
+	* @return the value of the chunk or void if it has none
+	* @throw evaluator_exception if an operation fails, frames are nested deeper than maxFrames or memory runs out
+	*/
+	Token run(const Chunk& c, class Evaluator& e) throw(class evaluator_exception);
+
+	//Most frames the machine holds at once, so runaway recursion in a script is reported before it uses up memory
+	static constexpr size_t maxFrames = 1000000;
+private:
+	/**
+	* Makes room for count more values. In a nested run the values are copied to a new stack, so operations of the callers keep theirs
+	*/
+	void reserve(size_t count);
+
+	/**
+	* Runs an exec of stored code or an if with a block as a new frame instead of evaluating the operation
+	* @param args    index of the first operand on the stack. The operation is above the operands
+	* @return false if the operation must be evaluated normally. Otherwise the operands have been replaced by the frame or the result
+	* @throw evaluator_exception if there are already maxFrames frames
+	*/
+	bool enter(size_t args, class Evaluator& e);
+};
@@ -0,0 +1,156 @@
+#include "CharClass.h"
+#if defined(__x86_64__) || defined(_M_X64)
+#define AML_X64 //SSE2 is always available on x64, AVX2 is checked for at runtime
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define AML_AVX2
+#else
+#define AML_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+namespace chars {
+	//Which run a scanner skips
+	enum class Run {
+		identifier, digits, space, string
+	};
+	//Classes a character must have to continue the run. Strings continue on anything but these
+	template<Run R>
+	constexpr uint8_t runClasses = R == Run::identifier ? ident : R == Run::digits ? digit : R == Run::space ? space : quote | escape;
+
+	template<Run R>
+	static const char* skipScalar(const char* p, const char* end)
+	{
+		if constexpr (R == Run::string)
+			while (p < end && !is(*p, runClasses<R>)) ++p;
+		else
+			while (p < end && is(*p, runClasses<R>)) ++p;
+		return p;
+	}
+#ifdef AML_X64
+	static inline unsigned firstSet(unsigned mask)
+	{
+#ifdef _MSC_VER
+		unsigned long i;
+		_BitScanForward(&i, mask);
+		return i;
+#else
+		return __builtin_ctz(mask);
+#endif
+	}
+
+	//Byte mask of the characters in x that continue the run
+	//All of the bounds are below 0x80 so the signed comparisons never accept bytes >= 0x80
+	template<Run R>
+	static inline __m128i runMask(__m128i x)
+	{
+		if constexpr (R == Run::identifier) {
+			__m128i lower = _mm_or_si128(x, _mm_set1_epi8(0x20));
+			__m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+			__m128i digit = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(x, _mm_set1_epi8('9' + 1)));
+			return _mm_or_si128(_mm_or_si128(letter, digit), _mm_cmpeq_epi8(x, _mm_set1_epi8('_')));
+		}
+		else if constexpr (R == Run::digits) {
+			return _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(x, _mm_set1_epi8('9' + 1)));
+		}
+		else if constexpr (R == Run::space) {
+			return _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(x, _mm_set1_epi8('\t'))),
+				_mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8('\r')), _mm_cmpeq_epi8(x, _mm_set1_epi8('\n'))));
+		}
+		else {
+			__m128i stop = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8('"')), _mm_cmpeq_epi8(x, _mm_set1_epi8('\''))),
+				_mm_cmpeq_epi8(x, _mm_set1_epi8('\\')));
+			return _mm_xor_si128(stop, _mm_set1_epi8(-1));
+		}
+	}
+	template<Run R>
+	static const char* skipSse2(const char* p, const char* end)
+	{
+		for (; end - p >= 16; p += 16) {
+			unsigned stop = ~(unsigned)_mm_movemask_epi8(runMask<R>(_mm_loadu_si128((const __m128i*)p))) & 0xFFFF;
+			if (stop != 0) return p + firstSet(stop);
+		}
+		return skipScalar<R>(p, end);
+	}
+
+	template<Run R>
+	AML_AVX2 static inline __m256i runMask(__m256i x)
+	{
+		if constexpr (R == Run::identifier) {
+			__m256i lower = _mm256_or_si256(x, _mm256_set1_epi8(0x20));
+			__m256i letter = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), lower));
+			__m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(x, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), x));
+			return _mm256_or_si256(_mm256_or_si256(letter, digit), _mm256_cmpeq_epi8(x, _mm256_set1_epi8('_')));
+		}
+		else if constexpr (R == Run::digits) {
+			return _mm256_and_si256(_mm256_cmpgt_epi8(x, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), x));
+		}
+		else if constexpr (R == Run::space) {
+			return _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(x, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(x, _mm256_set1_epi8('\t'))),
+				_mm256_or_si256(_mm256_cmpeq_epi8(x, _mm256_set1_epi8('\r')), _mm256_cmpeq_epi8(x, _mm256_set1_epi8('\n'))));
+		}
+		else {
+			__m256i stop = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(x, _mm256_set1_epi8('"')), _mm256_cmpeq_epi8(x, _mm256_set1_epi8('\''))),
+				_mm256_cmpeq_epi8(x, _mm256_set1_epi8('\\')));
+			return _mm256_xor_si256(stop, _mm256_set1_epi8(-1));
+		}
+	}
+	template<Run R>
+	AML_AVX2 static const char* skipAvx2(const char* p, const char* end)
+	{
+		for (; end - p >= 32; p += 32) {
+			unsigned stop = ~(unsigned)_mm256_movemask_epi8(runMask<R>(_mm256_loadu_si256((const __m256i*)p)));
+			if (stop != 0) return p + firstSet(stop);
+		}
+		return skipSse2<R>(p, end);
+	}
+
+	static bool hasAvx2()
+	{
+#ifdef _MSC_VER
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] < 7) return false;
+		__cpuid(info, 1);
+		if ((info[2] & (1 << 27)) == 0 || (_xgetbv(0) & 6) != 6) return false; //OS must save the ymm registers
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+#else
+		return __builtin_cpu_supports("avx2");
+#endif
+	}
+#endif
+	using Scanner = const char* (*)(const char*, const char*);
+	//Scanners for each run, picked once for the running cpu
+	struct Scanners {
+		Scanner identifier, digits, space, string;
+	};
+	static Scanners pickScanners()
+	{
+#ifdef AML_X64
+		if (hasAvx2())
+			return { skipAvx2<Run::identifier>, skipAvx2<Run::digits>, skipAvx2<Run::space>, skipAvx2<Run::string> };
+		return { skipSse2<Run::identifier>, skipSse2<Run::digits>, skipSse2<Run::space>, skipSse2<Run::string> };
+#else
+		return { skipScalar<Run::identifier>, skipScalar<Run::digits>, skipScalar<Run::space>, skipScalar<Run::string> };
+#endif
+	}
+	static const Scanners scanners = pickScanners();
+
+	const char* skipIdentifier(const char* p, const char* end)
+	{
+		return scanners.identifier(p, end);
+	}
+	const char* skipDigits(const char* p, const char* end)
+	{
+		return scanners.digits(p, end);
+	}
+	const char* skipSpace(const char* p, const char* end)
+	{
+		return scanners.space(p, end);
+	}
+	const char* skipString(const char* p, const char* end)
+	{
+		return scanners.string(p, end);
+	}
+}
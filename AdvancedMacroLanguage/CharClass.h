@@ -0,0 +1,48 @@
+#pragma once
+//Character classification and run scanning for the Tokenizer
+#include <stdint.h>
+#include <array>
+#include <initializer_list>
+namespace chars {
+	//Classes of a character. A character can be in several classes
+	enum CharClass : uint8_t {
+		space = 1, //' ', '\t', '\r', '\n'
+		digit = 2,
+		alpha = 4,
+		ident = 8, //alphanumeric or '_'
+		op = 16, //can be part of an operator
+		quote = 32,
+		escape = 64, //'\\'
+	};
+	constexpr std::array<uint8_t, 256> makeTable() {
+		std::array<uint8_t, 256> table{};
+		for (int c = '0'; c <= '9'; ++c) table[c] |= digit | ident;
+		for (int c = 'a'; c <= 'z'; ++c) table[c] |= alpha | ident;
+		for (int c = 'A'; c <= 'Z'; ++c) table[c] |= alpha | ident;
+		table['_'] |= ident;
+		for (unsigned char c : { ' ', '\t', '\r', '\n' }) table[c] |= space;
+		for (unsigned char c : { '*', '+', '-', '&', '!', '%', '^', '|', '=', '.', '>', '<', '/' }) table[c] |= op;
+		table['"'] |= quote;
+		table['\''] |= quote;
+		table['\\'] |= escape;
+		return table;
+	}
+	constexpr std::array<uint8_t, 256> table = makeTable();
+
+	constexpr inline bool is(char c, uint8_t classes) {
+		return (table[(unsigned char)c] & classes) != 0;
+	}
+
+	/**
+	* Run scanners. Each returns a pointer to the first character in [p, end) that ends the run, or end
+	* Long runs are scanned with SSE2 or AVX2, picked once at startup from what the cpu supports
+	*/
+	//Run of identifier characters (alphanumeric and '_')
+	const char* skipIdentifier(const char* p, const char* end);
+	//Run of decimal digits
+	const char* skipDigits(const char* p, const char* end);
+	//Run of whitespace
+	const char* skipSpace(const char* p, const char* end);
+	//Stops at the first quote or backslash, the end of a string literal without escapes
+	const char* skipString(const char* p, const char* end);
+}
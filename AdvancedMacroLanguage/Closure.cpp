@@ -0,0 +1,204 @@
+#include "Closure.h"
+#include "ParseTree.h"
+#include "Evaluator.h"
+#include "Optimizer.h"
+#include <array>
+#include <span>
+#include <memory>
+#include <algorithm>
+//Operations with at most this many arguments keep their operands in a fixed array on the stack
+constexpr size_t maxFixedArity = 4;
+
+static Closure fail(const std::string& message)
+{
+	return [message](Evaluator&) -> Token {
+		throw evaluator_exception(message);
+	};
+}
+
+template<size_t N>
+static Closure bind(std::vector<Closure>::iterator children, Tokens op, Evaluator::Operation f)
+{
+	std::array<Closure, N> args;
+	std::move(children, children + N, args.begin());
+	return [args = std::move(args), op, f](Evaluator& e) {
+		std::array<Token, N + 1> operands;
+		for (size_t i = 0; i < N; ++i)
+			operands[i] = args[i](e);
+		operands[N] = op;
+		Token res = (e.*f)(operands);
+		if (res.getType() == Tokens::invalid) throw evaluator_exception(e.getError());
+		return res;
+	};
+}
+
+//Operations with more arguments than maxFixedArity
+static Closure bindList(std::vector<Closure>::iterator children, size_t n, Tokens op, Evaluator::Operation f)
+{
+	std::vector<Closure> args(std::make_move_iterator(children), std::make_move_iterator(children + n));
+	return [args = std::move(args), op, f](Evaluator& e) {
+		std::vector<Token> operands;
+		operands.reserve(args.size() + 1);
+		for (const Closure& c : args)
+			operands.push_back(c(e));
+		operands.push_back(op);
+		Token res = (e.*f)(operands);
+		if (res.getType() == Tokens::invalid) throw evaluator_exception(e.getError());
+		return res;
+	};
+}
+
+//Operations whose operands after the first are skipped when the first decides the result. See Evaluator::lazy
+template<size_t N>
+static Closure bindLazy(std::vector<Closure>::iterator children, Tokens op, Evaluator::Operation f)
+{
+	std::array<Closure, N> args;
+	std::move(children, children + N, args.begin());
+	return [args = std::move(args), op, f](Evaluator& e) {
+		std::array<Token, N + 1> operands;
+		operands[0] = args[0](e);
+		Token res;
+		if (!e.decides(operands[0], op, res)) {
+			for (size_t i = 1; i < N; ++i)
+				operands[i] = args[i](e);
+			operands[N] = op;
+			res = (e.*f)(operands);
+		}
+		if (res.getType() == Tokens::invalid) throw evaluator_exception(e.getError());
+		return res;
+	};
+}
+
+//Lazy operations with more arguments than maxFixedArity
+static Closure bindLazyList(std::vector<Closure>::iterator children, size_t n, Tokens op, Evaluator::Operation f)
+{
+	std::vector<Closure> args(std::make_move_iterator(children), std::make_move_iterator(children + n));
+	return [args = std::move(args), op, f](Evaluator& e) {
+		std::vector<Token> operands;
+		operands.reserve(args.size() + 1);
+		operands.push_back(args[0](e));
+		Token res;
+		if (!e.decides(operands[0], op, res)) {
+			for (size_t i = 1; i < args.size(); ++i)
+				operands.push_back(args[i](e));
+			operands.push_back(op);
+			res = (e.*f)(operands);
+		}
+		if (res.getType() == Tokens::invalid) throw evaluator_exception(e.getError());
+		return res;
+	};
+}
+
+//Operations whose kernel is chosen from the types of their operands ahead of time
+static Closure bindKernel(std::vector<Closure>::iterator children, operators::Kernel k)
+{
+	return [a = std::move(children[0]), b = std::move(children[1]), k](Evaluator& e) {
+		Token x = a(e), y = b(e);
+		Token res = e.apply(k, x, y);
+		if (res.getType() == Tokens::invalid) throw evaluator_exception(e.getError());
+		return res;
+	};
+}
+
+/**
+* Binds a node to the closures of its children
+* Literals with children evaluate to their first child, like Evaluator::evaluate
+*/
+static Closure bindNode(const Token& t, std::vector<Closure>::iterator children, size_t n, operators::Kernel k)
+{
+	if (k != nullptr) return bindKernel(children, k);
+	if (t.getCategory() == TokenCategory::literals || t.getType() == Tokens::sx_void) {
+		if (n == 0) return [t](Evaluator&) { return t; };
+		std::vector<Closure> args(std::make_move_iterator(children), std::make_move_iterator(children + n));
+		return [args = std::move(args)](Evaluator& e) {
+			Token first = args[0](e);
+			for (size_t i = 1; i < args.size(); ++i) args[i](e);
+			return first;
+		};
+	}
+	Evaluator::Operation f = Evaluator::operation(t.getType());
+	if (f == nullptr) return fail("Unrecognized token category");
+	static_assert(maxFixedArity == 4, "bindNode must handle every fixed arity");
+	if (Evaluator::lazy(t.getType()) && n > 1) {
+		switch (n) {
+		case 2: return bindLazy<2>(children, t.getType(), f);
+		case 3: return bindLazy<3>(children, t.getType(), f);
+		case 4: return bindLazy<4>(children, t.getType(), f);
+		}
+		return bindLazyList(children, n, t.getType(), f);
+	}
+	switch (n) {
+	case 0: return bind<0>(children, t.getType(), f);
+	case 1: return bind<1>(children, t.getType(), f);
+	case 2: return bind<2>(children, t.getType(), f);
+	case 3: return bind<3>(children, t.getType(), f);
+	case 4: return bind<4>(children, t.getType(), f);
+	}
+	return bindList(children, n, t.getType(), f);
+}
+
+/**
+* Binds the nodes of a finished tree
+* A tree deeper than maxClosureDepth is copied and run by ParseTree::evaluate instead, which needs no native call per level
+* @param types    the type of each node, as given by inferTypes. Operators whose operands have a known type bind the kernel for those types
+*/
+static Closure compile(const FlatTree& flat, const std::vector<Tokens>& types)
+{
+	std::vector<uint32_t> depth(flat.size());
+	uint32_t deepest = 0;
+	for (uint32_t n = 0; n < flat.size(); ++n) {
+		for (uint32_t c = 0; c < flat.childCounts[n]; ++c) depth[n] = std::max(depth[n], depth[flat.children[flat.firstChild[n] + c]]);
+		deepest = std::max(deepest, ++depth[n]);
+	}
+	if (deepest > maxClosureDepth) {
+		auto tree = std::make_shared<ParseTree>();
+		for (uint32_t n = 0; n < flat.size(); ++n) tree->addNode(flat.token(n), flat.childCounts[n]);
+		return [tree](Evaluator& e) { return tree->evaluate(e); };
+	}
+	std::vector<Closure> values; //closures of the nodes whose parent has not been bound yet
+	for (uint32_t n = 0; n < flat.size(); ++n) {
+		auto first = values.end() - flat.childCounts[n];
+		const Tokens op = flat.types[n];
+		operators::Kernel k = nullptr;
+		if (types[n] != Tokens::invalid && flat.childCounts[n] == 2 && operators::hasKernel(op) && op != Tokens::op_eq && !Evaluator::lazy(op)) {
+			const uint32_t* operands = flat.children.data() + flat.firstChild[n];
+			k = operators::find(op, operators::tag(types[operands[0]]), operators::tag(types[operands[1]]));
+		}
+		Closure c = bindNode(flat.token(n), first, flat.childCounts[n], k);
+		values.erase(first, values.end());
+		values.push_back(std::move(c));
+	}
+	return std::move(values.back());
+}
+
+Closure compileClosure(ParseTree& tree)
+{
+	const FlatTree& flat = tree.finish();
+	return compile(flat, inferTypes(flat));
+}
+
+ClosureBlock compileClosureBlock(std::vector<ParseTree>& block)
+{
+	ClosureBlock b;
+	const std::vector<std::vector<Tokens>> types = inferTypes(block);
+	for (size_t s = 0; s < block.size(); ++s) {
+		try {
+			const FlatTree& flat = block[s].finish(); //throws for the first incomplete statement, which has no types
+			b.statements.push_back(compile(flat, types[s]));
+		}
+		catch (evaluator_exception& e) {
+			b.statements.push_back(fail(e.what()));
+			break; //nothing after the failure can run
+		}
+	}
+	return b;
+}
+
+Token ClosureBlock::run(Evaluator& e) const
+{
+	for (const Closure& statement : statements) {
+		Token t = statement(e);
+		if (t.getType() == Tokens::kw_return) return e.returnValue();
+	}
+	return Tokens::sx_void;
+}
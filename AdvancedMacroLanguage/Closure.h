@@ -0,0 +1,36 @@
+#pragma once
+//Compiles parse trees to closures, a lighter backend than the bytecode VM
+//Each node becomes a callable bound to its operation, the Evaluator member for it and the callables of its children
+//Running a tree is then a chain of direct calls with no dispatch on the token category
+#include "Tokens.h"
+#include <functional>
+#include <vector>
+using Closure = std::function<Token(class Evaluator&)>;
+
+//Deepest tree that is compiled to nested closures. Each level is a native call when it runs, so deeper trees, such as long chains of +, run on the ParseTree walker
+constexpr uint32_t maxClosureDepth = 1000;
+
+//Compiled form of a block of statements
+struct ClosureBlock {
+	std::vector<Closure> statements;
+	std::vector<Symbol> slots; //variables bound to slots of the block's scope. See resolveSlots
+
+	/**
+	* Runs the statements in order
+	* @return the value of a return statement or void
+	* @throw evaluator_exception if an operation fails
+	*/
+	Token run(class Evaluator& e) const;
+};
+
+/**
+* Compiles a single expression. Calling the closure gives the value of the expression
+* @throw evaluator_exception if the tree is incomplete
+*/
+Closure compileClosure(class ParseTree& tree) throw(class evaluator_exception);
+
+/**
+* Compiles the statements of a block
+* A statement that is incomplete compiles to a closure that throws so the error is reported when the block runs
+*/
+ClosureBlock compileClosureBlock(std::vector<class ParseTree>& block);
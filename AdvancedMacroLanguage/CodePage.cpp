@@ -4,25 +4,43 @@
 #include <unordered_map>
 #include <string>
 #include "Evaluator.h"
+#include "Bytecode.h"
+#include "Closure.h"
+#include "Optimizer.h"
 unsigned long CodePage::uid = 0;
 struct CodePage::code {
 	code* parent;
-	std::unordered_map<long, std::vector<ParseTree>> data;
+	std::unordered_map<long, std::variant<Chunk, ClosureBlock>> data; //compiled for the engine of the CodePage
+	std::unordered_map<long, ParseTree> bodies; //expressions of the blocks that can be inlined
 	code() : parent(nullptr) {};
 };
 
-CodePage::CodePage() : page(new code())
+CodePage::CodePage(Engine engine, bool inlining) : page(new code()), vm(new VirtualMachine(*this)), engine(engine), inlining(inlining), depth(0)
 {
 }
 
 CodePage::~CodePage()
 {
 	if (page != nullptr) delete page;
+	delete vm;
 }
 
 Token CodePage::add(std::vector<ParseTree>&& pt)
 {
-	page->data.emplace(uid, std::forward<std::vector<ParseTree>>(pt));
+	ParseTree body;
+	if (inlining && inlineBody(pt, body)) page->bodies.emplace(uid, std::move(body));
+	std::vector<Symbol> slots = resolveSlots(pt);
+	cacheSites(pt);
+	if (engine == Engine::closure) {
+		ClosureBlock b = compileClosureBlock(pt);
+		b.slots = std::move(slots);
+		page->data.emplace(uid, std::move(b));
+	}
+	else {
+		Chunk c = compileBlock(pt);
+		c.slots = std::move(slots);
+		page->data.emplace(uid, std::move(c));
+	}
 	Token t = Tokens::lit_code;
 	t.setData((long)(uid++));
 	return t;
@@ -52,29 +70,72 @@ Token CodePage::add(ParseTree&& pt, std::string& key)
 	return t;
 }*/
 
+Token CodePage::run(ParseTree& pt, Evaluator& e)
+{
+	if (engine == Engine::closure)
+		return compileClosure(pt)(e);
+	return vm->run(compileExpression(pt), e);
+}
+
 Token CodePage::eval(const Token& t, Evaluator& e)
 {
-	if (std::holds_alternative<long>(t.getData())) {
+	return enter(t, e, nullptr);
+}
+
+Token CodePage::call(const Token& t, Evaluator& e, std::span<Token> args)
+{
+	return enter(t, e, &args);
+}
+
+Token CodePage::enter(const Token& t, Evaluator& e, std::span<Token>* args)
+{
+	if (t.getData().holds<long>()) {
 		code* p = page;
 		while (p != nullptr) {
-			if (p->data.find(t.getInt()) != p->data.end()) {
-				e.newScope();
-				auto& list = p->data[t.getInt()];
-				for (ParseTree& p : list) {
-					Token t = p.evaluate(e);
-					if (t.getType() == Tokens::kw_return) {
-						Token v = Tokens::lit_var;
-						v.setData(t.getStr());
-						Token r = e.evalLit(v);
-						e.popScope();
-						return r;
-					}
+			auto block = p->data.find(t.getInt());
+			if (block != p->data.end()) {
+				if (depth == maxDepth) throw evaluator_exception("Code blocks nested deeper than " + std::to_string(maxDepth) + " levels");
+				++depth;
+				const std::vector<Symbol>* slots = engine == Engine::closure ? &std::get<ClosureBlock>(block->second).slots : &std::get<Chunk>(block->second).slots;
+				if (args != nullptr) e.newCall(slots, *args);
+				else e.newScope(slots);
+				try {
+					Token r = engine == Engine::closure ? std::get<ClosureBlock>(block->second).run(e) :
+						vm->run(std::get<Chunk>(block->second), e);
+					e.popScope();
+					--depth;
+					return r;
+				}
+				catch (evaluator_exception&) {
+					e.popScope();
+					--depth;
+					throw;
 				}
-				e.popScope();
-				return Tokens::sx_void;
 			}
-			p = page->parent;
+			p = p->parent;
 		}
 	}
 	return Tokens::invalid;
 }
+
+const FlatTree* CodePage::body(const Token& t)
+{
+	if (t.getType() == Tokens::lit_code && t.getData().holds<long>()) {
+		for (code* p = page; p != nullptr; p = p->parent) {
+			auto block = p->bodies.find(t.getInt());
+			if (block != p->bodies.end()) return &block->second.finish();
+		}
+	}
+	return nullptr;
+}
+
+const Chunk* CodePage::chunk(const Token& t) const
+{
+	if (t.getType() == Tokens::lit_code && t.getData().holds<long>()) {
+		for (code* p = page; p != nullptr; p = p->parent) {
+			auto block = p->data.find(t.getInt());
+			if (block != p->data.end()) return std::get_if<Chunk>(&block->second);
+		}
+	}
+	return nullptr;
+}
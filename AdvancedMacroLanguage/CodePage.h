@@ -1,26 +1,46 @@
 #pragma once
-//Stores executable parse trees
+//Stores executable code compiled from parse trees
 //Similar to the evaluator but for parse trees instead of tokens
 #include <memory>
 #include <vector>
+#include <span>
+//Backend that stored code is compiled for
+enum class Engine {
+	bytecode, //stack virtual machine, the default
+	closure, //pre-bound callables, selected with the interpreter argument engine:closure
+};
 class CodePage
 {
 private:
 	struct code;
 	code* page;
 	//Invariant: page is null iff CodePage was moved
+	class VirtualMachine* vm;
+	Engine engine;
+	bool inlining; //whether small blocks are kept to be inlined at exec calls, see inlineBody
+	int depth; //blocks being run by a native call of eval
 
 	static unsigned long uid;
+
+	/**Runs stored code in a new scope, or as the frame of an exec call if args is not null. See eval and call*/
+	class Token enter(const class Token& t, class Evaluator& e, std::span<class Token>* args);
 public:
-	CodePage();
+	CodePage(Engine engine = Engine::bytecode, bool inlining = true);
 	~CodePage();
 	/**
-	* Adds a parse tree to storage
+	* Resolves the variables of a block of parse trees, compiles it and adds it to storage
 	* For code that cannot be referred to later
 	* @return Token to be used to refer to the stored code
 	*/
 	class Token add(std::vector<class ParseTree>&& pt);
 
+	/**
+	* Compiles and runs a top level statement. The code is not stored
+	* @return the resultant token of the statement
+	* @throw evaluator exception if the tree is incomplete or an error occurs in evaluation
+	*/
+	class Token run(class ParseTree& pt, class Evaluator& e) throw(class evaluator_exception);
+
 	/**
 	* Clears toppmost temporary code storage
 	* Should be called upon exiting a scope
@@ -35,9 +55,26 @@ public:
 
 	/**
 	* Evaluates stored code
+	* Each block run this way uses the native stack, so nesting is limited to maxDepth
+	* The virtual machine runs exec and if blocks itself, without this limit
 	* @return the resultant token of executing the code or Invalid on error
-	* @throw evaluator exception if error occurs in evaluation
+	* @throw evaluator exception if error occurs in evaluation or the nesting is too deep
 	*/
 	class Token eval(const class Token& t, class Evaluator& e) throw(class evaluator_exception);
+
+	/**
+	* Evaluates stored code for exec. Like eval, but the scope of the block is the frame of the arguments, see Evaluator::newCall
+	* @return the resultant token of executing the code or Invalid on error
+	* @throw evaluator exception if error occurs in evaluation or the nesting is too deep
+	*/
+	class Token call(const class Token& t, class Evaluator& e, std::span<class Token> args) throw(class evaluator_exception);
+
+	/**@return the bytecode of stored code or nullptr if t does not refer to stored bytecode*/
+	const struct Chunk* chunk(const class Token& t) const;
+
+	/**@return the expression stored code returns if it can be inlined at exec calls, otherwise nullptr. See inlineCalls*/
+	const struct FlatTree* body(const class Token& t);
+
+	static constexpr int maxDepth = 1000;
 };
 
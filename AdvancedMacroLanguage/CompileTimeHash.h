@@ -3,10 +3,11 @@
 #include <tuple>
 #include <array>
 #include <utility>
+#include <algorithm>
 #include <stdexcept>
+#include <string_view>
+#include <cstdint>
 namespace cth {
-	constexpr static long BASE = 256;
-	constexpr static long MOD = 217500000;
 	constexpr size_t strlen_c(const char* str)
 	{
 		size_t len = 0;
@@ -18,21 +19,18 @@ namespace cth {
 		static_assert(std::is_integral<T>::value, "Must take the absolute value of a number");
 		return a < (T)0 ? -a : a;
 	}
-	//The actual hash function for the data
-	//Should be overloaded for every typename you wish to support
-	constexpr unsigned long firstHash(const char* str)
+	//64 bit FNV-1a with a final avalanche so the high bits are usable for short keys. One xor and one multiply per character
+	constexpr uint64_t hash(std::string_view str)
 	{
-		size_t len = strlen_c(str);
-		unsigned long r = 0;
-		for (size_t i = 0; i < len; ++i) {
-			r = r * (long long)BASE + str[i];
-			r %= MOD;
+		uint64_t h = 14695981039346656037ull;
+		for (char c : str) {
+			h ^= (unsigned char)c;
+			h *= 1099511628211ull;
 		}
-		return r;
-	}
-	constexpr unsigned long firstHash(const char str)
-	{
-		return str;
+		h ^= h >> 33;
+		h *= 0xff51afd7ed558ccdull;
+		h ^= h >> 33;
+		return h;
 	}
 	template<typename T>
 	constexpr void memset_c(T* data, T val, const size_t size)
@@ -40,11 +38,12 @@ namespace cth {
 		for (size_t i = 0; i < size; ++i)
 			data[i] = val;
 	}
-	template<typename T, typename = void>
-	struct is_hashable : std::false_type {};
-
-	template<typename T>
-	struct is_hashable<T, std::void_t<decltype(cth::firstHash(std::declval<T&>()))>> : std::true_type {};
+	constexpr size_t nextPow2(size_t n)
+	{
+		size_t p = 1;
+		while (p < n) p <<= 1;
+		return p;
+	}
 }
 //Exception thrown when the perfect hash could not be found
 class perfect_hash_exception : public std::exception 
@@ -122,118 +121,109 @@ public:
 	}
 };
 
-//Compile-time perfect hash table. Should be declared constexpr
-template<typename K, typename V>
-class CompileTimeHash
+/**
+* Compile-time perfect hash table with string keys (hash and displace). Should be declared constexpr
+* Keys are split into buckets by the high half of their hash. Each bucket stores a displacement, chosen when the
+* table is built, that sends every key of the bucket to a distinct empty slot
+* A lookup is a single hash of the key, one displacement read, one slot read and a length checked compare
+* Buckets average 4 keys and the table is at most 80% full, which keeps the displacement search short for thousands of keys
+*/
+template<typename V, size_t N>
+class PerfectHash
 {
 private:
-	constexpr const static long CTM_NAN = ~0;
-	//Due to step limits during compile time, size cannot be too big
-	//can be altered with compiler options with depth, backtrace and steps
-	constexpr const static long CTM_MAX_SIZE = 100;
-	Array<K, CTM_MAX_SIZE> keys; //must have an array wrapper bc we need a constexpr constructor
-	Array<V, CTM_MAX_SIZE> data;
-	Array<long, CTM_MAX_SIZE> shifts;
+	constexpr const static size_t BUCKETS = cth::nextPow2((N + 3) / 4);
+	constexpr const static size_t SLOTS = cth::nextPow2(N + N / 4 + 1);
+	//Displacements tried per bucket before giving up
+	constexpr const static uint32_t MAX_DISPLACEMENT = 1 << 20;
+	std::array<uint32_t, BUCKETS> displacements;
+	std::array<Tuple<std::string_view, V>, SLOTS> slots; //empty slots have a null key
 private:
-
+	constexpr static size_t bucket(uint64_t h) {
+		return (size_t)(h >> 32) & (BUCKETS - 1);
+	}
+	constexpr static size_t slot(uint64_t h, uint32_t displacement) {
+		const uint32_t step = (uint32_t)(h >> 32) | 1; //odd, so displacements cycle through every slot
+		return (size_t)((uint32_t)h + displacement * step) & (SLOTS - 1);
+	}
 	/**
-	* Determines if there are multiple elements in a single column of the table
-	* First row of the table is modified to reflect the collapsed table
-	* @param row    only searches the table at this row and above (lower)
-	* @param shift    the offset of each element in this row from their original position
-	* @return  true if there are multiple elements in the same column, false otherwise
+	* Finds the displacement that puts all keys of a bucket into empty slots
+	* @param keys    hashes of the keys in the bucket
+	* @param used    occupied slots. The slots of the bucket are marked on success
 	*/
-	constexpr bool isCollision(Array<Array<bool, CTM_MAX_SIZE>, CTM_MAX_SIZE> & table, const long row, const long shift = 0) const
-	{
-		if (row > 0) {
-			bool collision = false;
-			for (int i = 0; i < CTM_MAX_SIZE; ++i) {
-				if (table[row][i] && table[0][(i + shift) % CTM_MAX_SIZE]) {
-					collision = true;
-					break;
-				}
+	constexpr uint32_t place(const uint64_t* keys, size_t count, std::array<bool, SLOTS>& used) const {
+		for (uint32_t d = 0; d < MAX_DISPLACEMENT; ++d) {
+			bool fits = true;
+			for (size_t i = 0; i < count && fits; ++i) {
+				fits = !used[slot(keys[i], d)];
+				for (size_t j = 0; j < i && fits; ++j)
+					fits = slot(keys[i], d) != slot(keys[j], d);
 			}
-			if (!collision) {
-				for (int i = 0; i < CTM_MAX_SIZE; ++i) {
-					if (table[row][i])
-						table[0][(i + shift) % CTM_MAX_SIZE] = true;
-				}
+			if (fits) {
+				for (size_t i = 0; i < count; ++i)
+					used[slot(keys[i], d)] = true;
+				return d;
 			}
-			return collision;
 		}
-		return false;
+		throw perfect_hash_exception("Perfect hash cannot be created");
 	}
-	/**
-	* Determines the amoung the row should be shifted to avoid a collision
-	* @param row    the current row in the table
-	* @param table    2D MAX_SIZE * MAX_SIZE array. First row is modified by isCollision()
-	* @return   the amount this row should be shifted or MAX_SIZE on failure
-	*/
-	constexpr long calcShift(Array<Array<bool, CTM_MAX_SIZE>, CTM_MAX_SIZE> & table, const long row) const
-	{
-		long shift = 0;
-		for (; shift < CTM_MAX_SIZE && isCollision(table, row, shift); ++shift);
-		return shift;
-	}
-
-	constexpr unsigned long hash(K k) const {
-		unsigned long h = cth::firstHash(k);
-		return (shifts[(h / CTM_MAX_SIZE) % CTM_MAX_SIZE] + (h % CTM_MAX_SIZE)) % CTM_MAX_SIZE;
-	}
-	constexpr inline void init(const Tuple<K, V> list[], const long listSize) {
-		static_assert(cth::is_hashable<K&>::value, "Key value must be a hashable type");
-		Array<Array<bool, CTM_MAX_SIZE>, CTM_MAX_SIZE> table(false);
-		for (long i = 0; i < listSize; ++i) {
-			const unsigned long hash = cth::firstHash(list[i].key());
-			table[(hash / CTM_MAX_SIZE) % CTM_MAX_SIZE][hash % CTM_MAX_SIZE] = true;
+public:
+	constexpr PerfectHash(const Tuple<std::string_view, V>(&list)[N], const V& defaultVal) : displacements(), slots() {
+		std::array<uint64_t, N> hashes{};
+		std::array<size_t, BUCKETS + 1> start{}; //keys of bucket b are order[start[b], start[b + 1])
+		std::array<size_t, N> order{};
+		for (size_t i = 0; i < N; ++i) {
+			hashes[i] = cth::hash(list[i].k);
+			++start[bucket(hashes[i]) + 1];
 		}
-		for (long i = 0; i < CTM_MAX_SIZE; ++i) {
-			shifts[i] = calcShift(table, i);
-			shift_check(shifts[i]);
+		size_t largest = 0;
+		for (size_t b = 0; b < BUCKETS; ++b) {
+			largest = std::max(largest, start[b + 1]);
+			start[b + 1] += start[b];
 		}
-		for (long i = 0; i < listSize; ++i) {
-			long h = hash(list[i].key());
-			data[h] = list[i].val();
-			keys[h] = list[i].key();
-
+		std::array<size_t, BUCKETS> filled{};
+		for (size_t i = 0; i < N; ++i) {
+			size_t b = bucket(hashes[i]);
+			order[start[b] + filled[b]++] = i;
+		}
+		for (auto& s : slots) s = Tuple<std::string_view, V>(std::string_view(), defaultVal);
+		std::array<bool, SLOTS> used{};
+		uint64_t keys[N > 0 ? N : 1] = {};
+		for (size_t size = largest; size > 0; --size) { //largest buckets first, while the table is still empty
+			for (size_t b = 0; b < BUCKETS; ++b) {
+				if (start[b + 1] - start[b] != size) continue;
+				for (size_t i = 0; i < size; ++i) keys[i] = hashes[order[start[b] + i]];
+				displacements[b] = place(keys, size, used);
+				for (size_t i = 0; i < size; ++i) {
+					const auto& entry = list[order[start[b] + i]];
+					slots[slot(keys[i], displacements[b])] = entry;
+				}
+			}
 		}
-	}
-public:
-	//Checks if a perfect hash was found
-	//throwing during constexpr will be a compiler error
-	constexpr long shift_check(const long shiftAmount) const {
-		return shiftAmount >= CTM_MAX_SIZE ? throw perfect_hash_exception("Perfect hash cannot be created") : shiftAmount;
-	}
-	constexpr CompileTimeHash(const Tuple<K, V> list[], const long listSize) {
-		init(list, listSize);
-	}
-	constexpr CompileTimeHash(const Tuple<K, V> list[], const long listSize, const V& defaultVal) {
-		data.fill(defaultVal);
-		init(list, listSize);
-	}
-	//Gets the value in the bucker the key was hashed to
-	//Still has a return value if the key is not in the hash table
-	constexpr V operator[](K k) const {
-		return data[hash(k)];
-	}
-	constexpr bool find(K k) const {
-		return cth::firstHash(keys[hash(k)]) == cth::firstHash(k);
 	}
 
 	/**
 	* Gets a value for the given key if the given key is a value in the hash table
-	* @param K the key
+	* @param k the key
 	* @param v output parameter for the value returned by hashing the key. Only valid if the return is true
 	* @return boolean signifying if the key was found (true) or not (false)
 	*/
-	constexpr bool getifValid(K k, V& v) const {
-		long h = hash(k);
-		v = data[h];
-		return keys[h] != nullptr && cth::firstHash(keys[h]) == cth::firstHash(k);
+	constexpr bool getifValid(std::string_view k, V& v) const {
+		const uint64_t h = cth::hash(k);
+		const auto& entry = slots[slot(h, displacements[bucket(h)])];
+		v = entry.v;
+		return entry.k.size() == k.size() && entry.k.data() != nullptr && entry.k == k;
+	}
+	constexpr bool find(std::string_view k) const {
+		V v;
+		return getifValid(k, v);
 	}
-	
 };
-
-
-
-
+/**
+* Builds a PerfectHash for the list
+* @param defaultVal    value returned by getifValid for keys not in the table
+*/
+template<typename V, size_t N>
+constexpr PerfectHash<V, N> makePerfectHash(const Tuple<std::string_view, V>(&list)[N], const V& defaultVal) {
+	return PerfectHash<V, N>(list, defaultVal);
+}
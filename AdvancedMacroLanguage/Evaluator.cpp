@@ -2,18 +2,10 @@
 #include <time.h>
 #include <unordered_map>
 #include <stack>
+#include <algorithm>
 #include "Stream.h"
 #include "CodePage.h"
-//Linked stack of scopes
-//Invariant, root is the smallest scope, scopes are deleted as they are exited
-struct Evaluator::data {
-    std::unordered_map<std::string, Token> scope;
-    data* child;
-
-    data() : child(nullptr) {}
-
-};
-Token Evaluator::evaluate(std::vector<Token>& tokens)
+Token Evaluator::evaluate(std::span<Token> tokens)
 {
     if (tokens.empty()) return Tokens::invalid;
     switch (tokens[tokens.size() - 1].getCategory()) {
@@ -28,136 +20,93 @@ Token Evaluator::evaluate(std::vector<Token>& tokens)
         return evalOp(tokens);
     case TokenCategory::control_flow:
         return evalControl(tokens);
+    case TokenCategory::syntax:
+        if (tokens[tokens.size() - 1].getType() == Tokens::sx_void) return Tokens::sx_void; //left by a removed statement
+        break;
     }
     error = "Unrecognized token category";
     return Tokens::invalid;
 }
 
-Evaluator::Evaluator(Stream& outputStream, CodePage& code) : str(outputStream), code(&code)
+Evaluator::Operation Evaluator::operation(Tokens t)
 {
-    vars = new data();
+    switch (categoryOf(t)) {
+    case TokenCategory::functions:
+        return &Evaluator::evalFunc;
+    case TokenCategory::keywords:
+        return &Evaluator::evalKeys;
+    case TokenCategory::operators:
+        return &Evaluator::evalOp;
+    case TokenCategory::control_flow:
+        return &Evaluator::evalControl;
+    default:
+        return nullptr;
+    }
 }
 
-Evaluator::~Evaluator()
+Evaluator::Evaluator(Stream& outputStream, CodePage& code) : str(outputStream), code(&code)
 {
-    delete vars;
+    scopes.push_back({ 0, 0, nullptr, 0, -1 });
 }
 
-void Evaluator::newScope()
+Evaluator::~Evaluator()
 {
-    data* newScope = new data();
-    newScope->child = vars;
-    vars = newScope;
 }
 
-void Evaluator::popScope()
+void Evaluator::newScope(const std::vector<Symbol>* names)
 {
-    data* top = vars;
-    vars = vars->child;
-    delete top;
+    const size_t first = slots.size();
+    if (names != nullptr) slots.resize(first + names->size());
+    try {
+        scopes.push_back({ (uint32_t)bindings.size(), (uint32_t)first, names, 0, -1 });
+    }
+    catch (...) { //no scope is made if memory runs out
+        slots.resize(first);
+        throw;
+    }
 }
 
-Tokens Evaluator::largestType(std::vector<Token>::iterator argBegin, std::vector<Token>::iterator argEnd)
+void Evaluator::popScope()
 {
-    Tokens t = (Tokens)0;
-    //TODO: compatability checking
-    for (auto it = argBegin; it != argEnd; ++it) {
-        if ((uint16_t)it->getType() > (uint16_t)t)
-            t = it->getType();
+    const scope top = scopes.back();
+    for (size_t i = bindings.size(); i-- > top.bindings;) {
+        *visible.find(bindings[i].name) = bindings[i].shadowed;
+        if (bindings[i].shadowed >= 0) bindings[bindings[i].shadowed].hidden = false;
     }
-    return t;
+    bindings.resize(top.bindings);
+    slots.resize(top.slots);
+    scopes.pop_back();
 }
 
-TokenData Evaluator::convert(const TokenData& data, Tokens type) const
+void Evaluator::convert(Token& t, Tokens type) const
 {
-    TokenData t;
-    std::visit([&type, &data, this, &t](TokenData&& var) {
-        if (std::holds_alternative<long>(data)) {
-            long d = std::get<long>(data);
-            switch (type) {
-            case Tokens::lit_float:
-                t = (float)d;
-                break;
-            case Tokens::lit_long:
-                t = (long long)d;
-                break;
-            case Tokens::lit_dbl:
-                t = (double)d;
-                break;
-            case Tokens::lit_str:
-                t = std::to_string(d);
-                break;
-            default:
-                t = d;
-            }
-        }
-        else if (std::holds_alternative<std::string>(data)) {
-            t = std::get<std::string>(data);
-        }
-        else if (std::holds_alternative<long long>(data)) {
-            long long d = std::get<long long>(data);
-            switch (type) {
-            case Tokens::lit_float:
-                t = (float)d;
-                break;
-            case Tokens::lit_dbl:
-                t = (double)d;
-                break;
-            case Tokens::lit_str:
-                t = std::to_string(d);
-                break;
-            default:
-                t = d;
-            }
-        }
-        else if (std::holds_alternative<float>(data)) {
-            float d = std::get<float>(data);
+    t.getData().visit([&t, type](auto&& v) {
+        if constexpr (std::is_arithmetic_v<std::decay_t<decltype(v)>>) {
             switch (type) {
-            case Tokens::lit_dbl:
-                t = (double)d;
-                break;
-            case Tokens::lit_str:
-                t = std::to_string(d);
-                break;
-            default:
-                t = d;
+            case Tokens::lit_short:
+                t.setData((short)v);
                 break;
-            }
-        }
-        else if (std::holds_alternative<double>(data)) {
-            double d = std::get<double>(data);
-            switch (type) {
-            case Tokens::lit_str:
-                t = std::to_string(d);
-                break;
-            default:
-                t = d;
-            }
-        }
-        else if (std::holds_alternative<short>(data)) {
-            short d = std::get<short>(data);
-            switch (type) {
             case Tokens::lit_int:
-                t = (long)d;
-                break;
-            case Tokens::lit_float:
-                t = (float)d;
+                t.setData((long)v);
                 break;
             case Tokens::lit_long:
-                t = (long long)d;
+                t.setData((long long)v);
+                break;
+            case Tokens::lit_float:
+                t.setData((float)v);
                 break;
             case Tokens::lit_dbl:
-                t = (double)d;
+                t.setData((double)v);
                 break;
             case Tokens::lit_str:
-                t = std::to_string(d);
+                t.setData(std::string_view(numberString(v)));
                 break;
             default:
-                t = d;
+                return;
             }
+            t.setType(type);
         }
-    }, data);
-    return t;
+    });
 }
 
 Token Evaluator::evalLit(Token& t)
@@ -165,13 +114,18 @@ Token Evaluator::evalLit(Token& t)
 	switch (t.getType()) {
 	case Tokens::lit_var:
     {
-        data* scope = vars;
-        while (scope != nullptr) {
-            if (scope->scope.find(t.getStr()) != scope->scope.end())
-                return scope->scope[t.getStr()];
-            else scope = scope->child;
-        }
-        error = "Variable " + t.getStr() + " is undefined";
+        Token* v = find(t);
+        if (v != nullptr) return *v;
+        error = "Variable " + symbols::name(t.getSymbol()) + " is undefined";
+        return Tokens::invalid;
+    }
+    case Tokens::lit_slot:
+        return slot(t);
+    case Tokens::lit_arg:
+    {
+        Token* v = argument(t);
+        if (v != nullptr) return *v;
+        error = "Variable args_" + std::to_string(t.getInt()) + " is undefined";
         return Tokens::invalid;
     }
 	case Tokens::lit_code:
@@ -182,145 +136,201 @@ Token Evaluator::evalLit(Token& t)
     return Tokens::invalid;
 }
 
-Token Evaluator::evalOp(std::vector<Token>& tokens)
+Token* Evaluator::find(Symbol name)
 {
-    Token& operation = tokens[tokens.size() - 1];
-    Tokens t = operation.getType();
-    Token res;
-    if(t != Tokens::op_eq) resolveLiterals(tokens);
-    res.setType(largestType(tokens.begin(), tokens.begin() + tokens.size() - 1));
-    if (res.getType() != Tokens::invalid) {
-        for (int i = 0; i < tokens.size() - 1; ++i) {
-            if (tokens[i].getType() != res.getType()) {
-                tokens[i].setType(res.getType());
-                tokens[i].setVar(convert(tokens[i].getData(), res.getType()));
-            }
+    const int32_t* innermost = visible.find(name);
+    const int32_t b = innermost == nullptr ? -1 : *innermost;
+    const int32_t position = symbols::argumentPosition(name);
+    if (position >= 0) {
+        //frames above the scope of the binding hide it
+        for (size_t s = scopes.size(); s-- > 0 && b < (int32_t)scopes[s].bindings;) {
+            if (Token* arg = argument(scopes[s], position)) return arg;
         }
-        size_t arguments = tokens.size() - 1;
-        switch (operation.getType()) {
-        case Tokens::op_plus:
-            if (arguments != 2) error = "Invalid number of arguments for operator +";
-            else res = add(tokens[0].getData(), tokens[1].getData(), res.getType());
-            break;
-        case Tokens::op_minus:
-            if (arguments != 2) error = "Invalid number of arguments for operator -";
-            else res = sub(tokens[0].getData(), tokens[1].getData(), res.getType());
-            break;
-        case Tokens::op_mul:
-            if (arguments != 2) error = "Invalid number of arguments for operator *";
-            else res = mul(tokens[0].getData(), tokens[1].getData(), res.getType());
-            break;
-        case Tokens::op_div:
-            if (arguments != 2) error = "Invalid number of arguments for operator /";
-            else res = div(tokens[0].getData(), tokens[1].getData(), res.getType());
-            break;
-        case Tokens::op_exp:
-            if (arguments != 2) error = "Invalid number of arguments for operator **";
-            else res = power(tokens[0].getData(), tokens[1].getData(), res.getType());
-            break;
-        case Tokens::op_test:
-            if (arguments != 2) error = "Invalid number of arguments for operator ==";
-            else res = test(tokens[0].getData(), tokens[1].getData(), res.getType());
-            break;
-        case Tokens::op_ne:
-            if (arguments != 2) error = "Invalid number of arguments for operator !=";
-            else res = not_test(tokens[0].getData(), tokens[1].getData(), res.getType());
-            break;
-        case Tokens::op_and:
-            if (arguments != 2) error = "Invalid number of arguments for operator &&";
-            else res = bool_and(tokens[0].getData(), tokens[1].getData(), res.getType());
-            break;
-        case Tokens::op_or:
-            if (arguments != 2) error = "Invalid number of arguments for operator ||";
-            else res = bool_or(tokens[0].getData(), tokens[1].getData(), res.getType());
-            break;
-        case Tokens::op_bit_and:
-            if (arguments != 2) error = "Invalid number of arguments for operator &";
-            else res = bit_and(tokens[0].getData(), tokens[1].getData(), res.getType());
-            break;
-        case Tokens::op_bit_or:
-            if (arguments != 2) error = "Invalid number of arguments for operator |";
-            else res = bit_or(tokens[0].getData(), tokens[1].getData(), res.getType());
-            break;
-        case Tokens::op_xor:
-            if (arguments != 2) error = "Invalid number of arguments for operator ^";
-            else res = bit_xor(tokens[0].getData(), tokens[1].getData(), res.getType());
-            break;
-        case Tokens::op_bool_xor:
-            if (arguments != 2) error = "Invalid number of arguments for operator ^^";
-            else res = bool_xor(tokens[0].getData(), tokens[1].getData(), res.getType());
-            break;
-        case Tokens::op_sh_left:
-            if (arguments != 2) error = "Invalid number of arguments for operator <<";
-            else res = shift_left(tokens[0].getData(), tokens[1].getData(), res.getType());
-            break;
-        case Tokens::op_sh_right:
-            if (arguments != 2) error = "Invalid number of arguments for operator >>";
-            else res = shift_right(tokens[0].getData(), tokens[1].getData(), res.getType());
-            break;
-        case Tokens::op_gr:
-            if (arguments != 2) error = "Invalid number of arguments for operator >";
-            else res = greater(tokens[0].getData(), tokens[1].getData(), res.getType());
-            break;
-        case Tokens::op_gre:
-            if (arguments != 2) error = "Invalid number of arguments for operator >=";
-            else res = greater_eq(tokens[0].getData(), tokens[1].getData(), res.getType());
-            break;
-        case Tokens::op_le:
-            if (arguments != 2) error = "Invalid number of arguments for operator <";
-            else res = less(tokens[0].getData(), tokens[1].getData(), res.getType());
-            break;
-        case Tokens::op_lee:
-            if (arguments != 2) error = "Invalid number of arguments for operator <=";
-            else res = less_eq(tokens[0].getData(), tokens[1].getData(), res.getType());
-            break;
-        case Tokens::op_eq:
-            if (arguments != 2) error = "Invalid number of arguments for operator =";
-            else {
-                res = tokens[1];
-                data* scope = vars;
-                while (scope != nullptr) {
-                    if (scope->scope.find(tokens[0].getStr()) != scope->scope.end()) {
-                        scope->scope[tokens[0].getStr()] = tokens[1];
-                        break;
-                    }
-                    else scope = scope->child;
-                }
-            }
-            break;
-        default:
-            error = "Invalid operation";
-            res.setType(Tokens::invalid);
+    }
+    return b < 0 ? nullptr : &valueOf(bindings[b]);
+}
+
+Token* Evaluator::argument(const Token& t)
+{
+    const long position = t.getInt();
+    if (Token* arg = argument(scopes.back(), position)) return arg;
+    return find(position == symbols::lengthPosition ? symbols::argsLength() : symbols::argument(position));
+}
+
+Token* Evaluator::find(const Token& var)
+{
+    const Symbol name = var.getSymbol();
+    const uint32_t site = var.getSite();
+    if (site == 0) return find(name);
+    if (site < sites.size()) {
+        const int32_t b = sites[site];
+        if (b >= 0 && (size_t)b < bindings.size() && bindings[b].name == name && !bindings[b].hidden)
+            return &valueOf(bindings[b]);
+    }
+    else sites.resize(site + 1, -1);
+    const int32_t* innermost = visible.find(name);
+    if (innermost == nullptr || *innermost < 0) return nullptr;
+    sites[site] = *innermost;
+    return &valueOf(bindings[*innermost]);
+}
+
+Token& Evaluator::bind(Symbol name, int slot)
+{
+    int32_t& innermost = visible.tryEmplace(name, -1);
+    if (innermost < 0 || innermost < (int32_t)scopes.back().bindings) {
+        const int32_t at = slot >= 0 ? (int32_t)(scopes.back().slots + slot) : -1;
+        if (innermost >= 0) bindings[innermost].hidden = true;
+        bindings.push_back({ name, innermost, at, false, Token() });
+        innermost = (int32_t)bindings.size() - 1;
+    }
+    return valueOf(bindings[innermost]);
+}
+
+void Evaluator::newCall(const std::vector<Symbol>* names, std::span<Token> args)
+{
+    for (Token& arg : args) arg = variableValue(arg); //names refer to the caller's scope
+    newScope(names);
+    scope& frame = scopes.back();
+    frame.args = (uint32_t)slots.size();
+    frame.argc = (int32_t)args.size();
+    Token aLength = Tokens::lit_int;
+    aLength.setData((long)args.size());
+    try {
+        slots.insert(slots.end(), std::make_move_iterator(args.begin()), std::make_move_iterator(args.end()));
+        slots.push_back(aLength);
+    }
+    catch (...) {
+        popScope();
+        throw;
+    }
+}
+
+bool Evaluator::isTrue(Token& t)
+{
+    t = evalLit(t);
+    return t.getData().visit([](auto&& v) -> bool {
+        if constexpr (std::is_arithmetic_v<std::decay_t<decltype(v)>>) return v != 0;
+        else return !v.empty();
+    });
+}
+
+bool Evaluator::decides(Token& first, Tokens op, Token& result)
+{
+    first = evalLit(first);
+    if (first.getType() == Tokens::invalid) {
+        result = Tokens::invalid;
+        return true;
+    }
+    const bool truth = isTrue(first);
+    switch (op) {
+    case Tokens::op_and:
+    case Tokens::op_or:
+        if (truth != (op == Tokens::op_or)) return false;
+        else {
+            Token operands[] = { first, first, op }; //gives the decided value in the type of the operand
+            result = evalOp(operands);
         }
+        return true;
+    case Tokens::ct_if:
+        if (truth) return false;
+        result = Tokens::sx_void;
+        return true;
+    default:
+        break;
     }
-    return res;
+    return false;
+}
+
+Token Evaluator::evalOp(std::span<Token> tokens)
+{
+    const Tokens op = tokens[tokens.size() - 1].getType();
+    if (op == Tokens::op_eq) return assign(tokens);
+    if (!operators::hasKernel(op)) {
+        error = "Invalid operation";
+        return Tokens::invalid;
+    }
+    if (tokens.size() != 3) {
+        error = std::string("Invalid number of arguments for operator ") + operators::name(op);
+        return Tokens::invalid;
+    }
+    resolveLiterals(tokens.first(2));
+    const size_t a = operators::tag(tokens[0]), b = operators::tag(tokens[1]);
+    if (a == operators::notOperand || b == operators::notOperand) {
+        const Token& bad = a == operators::notOperand ? tokens[0] : tokens[1];
+        if (bad.getType() != Tokens::invalid) //otherwise the error is already set by whatever gave it
+            error = "Type id " + std::to_string((uint16_t)bad.getType()) + " unsupported as an operand for operator '" + operators::name(op) + "'";
+        return Tokens::invalid;
+    }
+    return operators::find(op, a, b)(tokens[0].getData(), tokens[1].getData(), error);
+}
+
+Token Evaluator::apply(operators::Kernel k, const Token& a, const Token& b)
+{
+    const Token& x = a.getType() == Tokens::lit_slot ? slot(a) : a;
+    const Token& y = b.getType() == Tokens::lit_slot ? slot(b) : b;
+    return k(x.getData(), y.getData(), error);
+}
+
+Token Evaluator::assign(std::span<Token> tokens)
+{
+    if (tokens.size() != 3) {
+        error = "Invalid number of arguments for operator =";
+        return Tokens::invalid;
+    }
+    Token value = variableValue(tokens[1]);
+    switch (tokens[0].getType()) {
+    case Tokens::lit_slot:
+        slot(tokens[0]) = value;
+        break;
+    case Tokens::lit_var:
+    {
+        Token* v = find(tokens[0]);
+        if (v != nullptr) *v = value;
+        break;
+    }
+    case Tokens::lit_arg:
+    {
+        Token* v = argument(tokens[0]);
+        if (v != nullptr) *v = value;
+        break;
+    }
+    default:
+        error = "Only variables can be assigned to";
+        return Tokens::invalid;
+    }
+    return value;
 }
 
-Token Evaluator::evalFunc(std::vector<Token>& tokens)
+Token Evaluator::evalFunc(std::span<Token> tokens)
 {
     Token& operation = tokens[tokens.size() - 1];
-    Tokens t = operation.getType();
     Token res;
 	size_t arguments = tokens.size() - 1;
     resolveLiterals(tokens);
 	switch (operation.getType()) {
 	case Tokens::func_print:
         for (size_t i = 0; i < arguments; ++i) {
-            if (tokens[i].getType() != Tokens::invalid) {
-                if (tokens[i].getType() == Tokens::lit_str) fputs(tokens[i].literalValue().c_str(), str);
-                else {
-                    std::string s = tokens[i].literalValue();
-                    fputs(s.c_str(), str);
-                }
-            }
+            if (tokens[i].getType() != Tokens::invalid)
+                tokens[i].print(str);
         }
 		res.setType(Tokens::sx_void);
 		break;
 	case Tokens::func_rand:
 		if (arguments == 2) { //min and max
+			convert(tokens[0], Tokens::lit_int);
+			convert(tokens[1], Tokens::lit_int);
+			if (tokens[0].getType() != Tokens::lit_int || tokens[1].getType() != Tokens::lit_int) {
+				error = "The bounds of random must be numbers";
+				res.setType(Tokens::invalid);
+				break;
+			}
+			if (tokens[1].getInt() <= tokens[0].getInt()) {
+				error = "The max of random must be greater than its min";
+				res.setType(Tokens::invalid);
+				break;
+			}
 			srand(clock());
-			TokenData min = convert(tokens[0].getData(), Tokens::lit_int), max = convert(tokens[1].getData(), Tokens::lit_int);
-			res.setData(rand() % (std::get<long>(max) - std::get<long>(min)) + std::get<long>(min));
+			res.setData((long)(rand() % ((long long)tokens[1].getInt() - tokens[0].getInt()) + tokens[0].getInt()));
 			res.setType(Tokens::lit_int);
 		}
 		else { //0 to 1
@@ -344,17 +354,24 @@ Token Evaluator::evalFunc(std::vector<Token>& tokens)
     return res;
 }
 
-Token Evaluator::evalKeys(std::vector<Token>& tokens)
+Token Evaluator::evalKeys(std::span<Token> tokens)
 {
     Token& operation = tokens[tokens.size() - 1];
-    Tokens t = operation.getType();
     Token res;
 	size_t arguments = tokens.size() - 1;
 	switch (operation.getType()) {
 	case Tokens::kw_decl:
 		if (arguments != 1) error = "Invalid number of arguments for operator decl";
+        else if (tokens[0].getType() != Tokens::lit_var && tokens[0].getType() != Tokens::lit_slot) error = "Only variables can be declared";
         else {
-            vars->scope[tokens[0].getStr()];
+            const std::vector<Symbol>* names = scopes.back().names;
+            int slot = -1;
+            if (tokens[0].getType() == Tokens::lit_slot) slot = (int)tokens[0].getInt();
+            else if (names != nullptr) { //a slot of the scope declared before the resolver bound its name
+                auto it = std::find(names->begin(), names->end(), tokens[0].getSymbol());
+                if (it != names->end()) slot = (int)(it - names->begin());
+            }
+            bind(slot >= 0 ? (*names)[slot] : tokens[0].getSymbol(), slot);
             res = tokens[0];
         }
 		break;
@@ -368,28 +385,15 @@ Token Evaluator::evalKeys(std::vector<Token>& tokens)
 		break;
     case Tokens::kw_exec:
     {
-        newScope();
-        for (int i = 1; i < tokens.size() - 1; ++i) {
-            vars->scope["args_" + std::to_string(i - 1)] = tokens[i];
-        }
-        Token aLength = Tokens::lit_int;
-        aLength.setData((long)tokens.size() - 2);
-        vars->scope["args_length"] = aLength;
-        if (tokens[0].getType() == Tokens::lit_var) {
-            res = evalLit(tokens[0]);
-            res = evalLit(res);
-        }
-        else
-            res = evalLit(tokens[0]);
-        popScope();
+        Token callee = variableValue(tokens[0]);
+        res = callee.getType() == Tokens::lit_code ? code->call(callee, *this, tokens.subspan(1, tokens.size() - 2)) : callee;
         break;
     }
     case Tokens::kw_return:
         if (arguments > 1) error = "Too many arguments for return";
         else {
             res.setType(Tokens::kw_return);
-            res.setData("return_value");
-            vars->scope["return_value"] = tokens[0];
+            returned = variableValue(tokens[0]); //the value, as its variable may go out of scope with the block
         }
         break;
 	default:
@@ -399,148 +403,18 @@ Token Evaluator::evalKeys(std::vector<Token>& tokens)
     return res;
 }
 
-Token Evaluator::evalControl(std::vector<Token>& tokens)
+Token Evaluator::evalControl(std::span<Token> tokens)
 {
     Token& operation = tokens[tokens.size() - 1];
-    Tokens t = operation.getType();
-    Token res;
-    size_t arguments = tokens.size() - 1;
     switch (operation.getType()) {
     case Tokens::ct_if:
-        tokens[0] = evalLit(tokens[0]);
-        if (std::get<long>(convert(tokens[0].getData(), Tokens::lit_int)) != 0)
+        if (isTrue(tokens[0]))
             evalLit(tokens[1]);
         return Tokens::sx_void;
         break;
-    }
-    return Tokens::invalid;
-
-}
-
-Token Evaluator::add(TokenData&& a, TokenData&& b, Tokens type) const
-{
-    Token t;
-    t.setType(type);
-    switch (type) {
-    case Tokens::lit_short:
-        t.setData((short)(std::get<short>(a) + std::get<short>(b)));
-        break;
-    case Tokens::lit_int:
-        t.setData(std::get<long>(a) + std::get<long>(b));
-        break;
-    case Tokens::lit_long:
-        t.setData(std::get<long long>(a) + std::get<long long>(b));
-        break;
-    case Tokens::lit_float:
-        t.setData(std::get<float>(a) + std::get<float>(b));
-        break;
-    case Tokens::lit_dbl:
-        t.setData(std::get<double>(a) + std::get<double>(b));
-        break;
-    case Tokens::lit_str:
-        t.setData(std::get<std::string>(a) + std::get<std::string>(b));
-        break;
     default:
-        error = "Type id " + std::to_string((uint16_t)type) + " unsupported as an operand for addition";
-        t.setType(Tokens::invalid);
         break;
     }
-    return t;
-}
-#define MATH_OPERATOR_DEF(NAME, OP) \
-Token Evaluator::NAME(TokenData&& a, TokenData&& b, Tokens type) const \
-{ \
-    Token t; \
-    t.setType(type); \
-    switch (type) { \
-    case Tokens::lit_short: \
-        t.setData((short)(std::get<short>(a) OP std::get<short>(b))); \
-        break; \
-    case Tokens::lit_int: \
-        t.setData(std::get<long>(a) OP std::get<long>(b)); \
-        break; \
-    case Tokens::lit_long: \
-        t.setData(std::get<long long>(a) OP std::get<long long>(b)); \
-        break; \
-    case Tokens::lit_float: \
-        t.setData(std::get<float>(a) OP std::get<float>(b)); \
-        break; \
-    case Tokens::lit_dbl: \
-        t.setData(std::get<double>(a) OP std::get<double>(b)); \
-        break; \
-    default: \
-        error = "Type id " + std::to_string((uint16_t)type) + " unsupported as an operand for operator '" #OP "'"; \
-        t.setType(Tokens::invalid); \
-        break; \
-    } \
-    return t; \
-}
+    return Tokens::invalid;
 
-#define CUSTOM_OPERATOR_DEF(NAME, FUNC, FUNCSTR) \
-Token Evaluator::NAME(TokenData&& a, TokenData&& b, Tokens type) const \
-{ \
-    Token t; \
-    t.setType(type); \
-    switch (type) { \
-    case Tokens::lit_short: \
-        t.setData((short)(FUNC(std::get<short>(a), std::get<short>(b)))); \
-        break; \
-    case Tokens::lit_int: \
-        t.setData((long)(FUNC(std::get<long>(a), std::get<long>(b)))); \
-        break; \
-    case Tokens::lit_long: \
-        t.setData((long long)(FUNC(std::get<long long>(a), std::get<long long>(b)))); \
-        break; \
-    case Tokens::lit_float: \
-        t.setData((float)(FUNC(std::get<float>(a), std::get<float>(b)))); \
-        break; \
-    case Tokens::lit_dbl: \
-        t.setData((double)(FUNC(std::get<double>(a), std::get<double>(b)))); \
-        break; \
-    case Tokens::lit_str: \
-        t.setData(FUNCSTR(std::get<std::string>(a), std::get<std::string>(b))); \
-        break; \
-    default: \
-        error = "Type id " + std::to_string((uint16_t)type) + " unsupported as an operand for operator '" #FUNC "'"; \
-        t.setType(Tokens::invalid); \
-        break; \
-    } \
-    return t; \
 }
-#define IGNORE_FUNC(A, B) "Error"
-#define CUSTOM_MATH_OPERATOR_DEF(NAME, FUNC) CUSTOM_OPERATOR_DEF(NAME, FUNC, IGNORE_FUNC)
-
-MATH_OPERATOR_DEF(sub, -);
-MATH_OPERATOR_DEF(mul, *);
-MATH_OPERATOR_DEF(div, /);
-#define BOOL_EQ(A, B) A == B
-#define BOOL_UNEQ(A, B) A != B
-CUSTOM_OPERATOR_DEF(test, BOOL_EQ, BOOL_EQ);
-CUSTOM_OPERATOR_DEF(not_test, BOOL_UNEQ, BOOL_UNEQ);
-MATH_OPERATOR_DEF(bool_and, &&);
-MATH_OPERATOR_DEF(bool_or, ||);
-
-#define BIT_AND(A, B) ((long long)(A) & (long long)(B))
-#define BIT_OR(A, B) ((long long)(A) | (long long)(B))
-#define BIT_XOR(A, B) ((long long)(A) ^ (long long)(B))
-#define MOD(A, B) ((long long)(A) % (long long)(B))
-#define SHIFTL(A, B) ((long long)(A) << (long long)(B))
-#define SHIFTR(A, B) ((long long)(A) >> (long long)(B))
-CUSTOM_MATH_OPERATOR_DEF(bit_and, BIT_AND);
-CUSTOM_MATH_OPERATOR_DEF(bit_or, BIT_OR);
-CUSTOM_MATH_OPERATOR_DEF(bit_xor, BIT_XOR);
-CUSTOM_MATH_OPERATOR_DEF(power, pow);
-CUSTOM_MATH_OPERATOR_DEF(mod, MOD);
-CUSTOM_MATH_OPERATOR_DEF(shift_left, SHIFTL);
-CUSTOM_MATH_OPERATOR_DEF(shift_right, SHIFTR);
-#define BOOL_LESS(A, B) A < B
-CUSTOM_OPERATOR_DEF(less, BOOL_LESS, BOOL_LESS);
-#define BOOL_GREATER(A, B) A > B
-CUSTOM_OPERATOR_DEF(greater, BOOL_GREATER, BOOL_GREATER)
-#define BOOL_LESS_EQ(A, B) A <= B
-CUSTOM_OPERATOR_DEF(less_eq, BOOL_LESS_EQ, BOOL_LESS_EQ)
-#define BOOL_GREATER_EQ(A, B) A >= B
-CUSTOM_OPERATOR_DEF(greater_eq, BOOL_GREATER_EQ, BOOL_GREATER_EQ)
-#define BOOL_XOR(A, B) ((A || B) && (!A || !B))
-CUSTOM_MATH_OPERATOR_DEF(bool_xor, BOOL_XOR);
-
@@ -2,16 +2,38 @@
 //Computes arrangement of tokens
 //Stores variables
 #include "Tokens.h"
+#include "Operators.h"
+#include "SymbolMap.h"
 #include <vector>
+#include <span>
 #include <unordered_map>
 class Evaluator
 {
 private:
 	mutable std::string error;
-	struct data;
-	data* vars;
-	//Linked stack of scopes of variables
-	//Invariant: vars is not null
+	//A variable visible by name. Bindings are pushed in the order they are made and cut back when their scope is left
+	struct binding {
+		Symbol name;
+		int32_t shadowed; //binding of the same name this one hides, restored when it is cut back, or -1
+		int32_t slot; //index in slots if the variable is a slot, otherwise -1 and the value is held here
+		bool hidden; //whether a later binding of the same name hides this one. Only the innermost binding of a name is not hidden
+		Token value;
+	};
+	struct scope {
+		uint32_t bindings; //first binding of the scope
+		uint32_t slots; //first slot of the scope
+		const std::vector<Symbol>* names; //name of each slot of the scope or null if it has none
+		uint32_t args; //slot of the first argument if the scope is the frame of an exec call. The arguments follow the named slots, then args_length
+		int32_t argc; //number of arguments or -1 if the scope is not a frame
+	};
+	//Stack of scopes of variables. The vectors keep their capacity, so entering and leaving a scope does not allocate once they have grown
+	//Invariant: scopes is not empty, its first scope is the global one
+	std::vector<scope> scopes;
+	std::vector<binding> bindings;
+	std::vector<Token> slots; //slots of every scope, read by index from the first slot of the innermost scope
+	SymbolMap<int32_t> visible; //innermost binding of each name or -1
+	std::vector<int32_t> sites; //binding each variable reference with an inline cache site last resolved to, or -1
+	Token returned; //value of the last return, until the block it ended takes it
 	FILE* str;
 	//STR is not an owned resource
 	class CodePage* code;
@@ -19,18 +41,32 @@ private:
 public:
 	/**
 	* Evaluates an expression, which is required to be in postfix notation
+	* The tokens are used as scratch space and may be changed
 	* @return a token of the largest type. Can be void. Will return Token::invalid and set the error string on error
 	*/
-	Token evaluate(std::vector<Token>& tokens);
+	Token evaluate(std::span<Token> tokens);
 
 	std::string getError() const { return error; }
 
+	//Evaluates a postfix expression whose operation is of one category
+	using Operation = Token(Evaluator::*)(std::span<Token>);
+
+	/**
+	* Resolves the part of evaluate that only depends on the operation so it can be done ahead of time
+	* @return the member that evaluate would call for an operation of type t or nullptr if evaluate has none (literals and syntax)
+	*/
+	static Operation operation(Tokens t);
+
 	/**@param outputStream   the stream to the output file. Used for functions such as print*/
 	Evaluator(class Stream& outputStream, class CodePage& code);
 	~Evaluator();
 
-	/**Creates a new scope and sets it to the root of the scope stack (lowest)*/
-	void newScope();
+	/**
+	* Creates a new scope and sets it to the root of the scope stack (lowest)
+	* @param slots    names of the variables the resolver bound to slots of the scope, or null. Not owned, must outlive the scope
+	* @throw std::bad_alloc if memory runs out, in which case no scope is made
+	*/
+	void newScope(const std::vector<Symbol>* slots = nullptr);
 	/**
 	* Deletes the lowest scope from the stack
 	* Requires that pop is called only as many times as newScope. No more, no less
@@ -46,32 +82,120 @@ public:
 	*/
 	Token evalLit(Token& t);
 
+	/**
+	* Creates the scope of a block run by exec, which is the frame of its arguments
+	* The arguments are stored by position after the slots, and the block reads them as args_0, args_1 ... and args_length
+	* Variables passed as arguments are replaced by their values first
+	* Requires that popScope be called when the call is done
+	* @param slots    names of the slots of the block, as for newScope
+	* @throw std::bad_alloc if memory runs out, in which case no scope is made
+	*/
+	void newCall(const std::vector<Symbol>* slots, std::span<Token> args);
+
+	/**@return the value of the last return, which a statement giving kw_return leaves for the block it ends. Moved out, so it is taken once*/
+	inline Token returnValue() {
+		return std::move(returned);
+	}
 
-private:
 	/**
-	* The largest type is the return type of an operation of two different type.
-	* Ex long long + short will return a long long
-	* In general from smallest to largest: short -> int -> long -> float -> double -> string
-	* Invalid is returned if two types aren't compatible as operands (ie. int[] and string)
-	* @return the "largest" type in the argument list or invalid on error
+	* Resolves t in place
+	* @return whether it is nonzero (not empty for strings), the test of an if
 	*/
-	Tokens largestType(std::vector<Token>::iterator argBegin, std::vector<Token>::iterator argEnd);
+	bool isTrue(Token& t);
+
+	/**@return true if the operands of t after the first are only evaluated when the first does not decide the result*/
+	static constexpr bool lazy(Tokens t) {
+		return t == Tokens::op_and || t == Tokens::op_or || t == Tokens::ct_if;
+	}
+
+	/**
+	* Tests the first operand of a lazy operation. Resolves first in place
+	* A false operand decides && and if, a true one decides ||
+	* @param result    set to the value of the operation if it is decided: the operand && or || itself, or void for an if. Invalid on error
+	* @return true if the rest of the operands must not be evaluated
+	*/
+	bool decides(Token& first, Tokens op, Token& result);
 
 	/**
-	* @param data the data to convert
+	* Runs a kernel chosen before the code ran, from the types inferTypes gives its operands. Skips the checks of evalOp
+	* Requires that the values of a and b have the types the kernel was chosen for. Slots are read in place
+	* @return the result or invalid on error
+	*/
+	Token apply(operators::Kernel k, const Token& a, const Token& b);
+
+
+private:
+	/**
+	* Converts a number to type in place, narrowing it if type is smaller. Strings and other values are kept as they are, type included
+	* @param t the value to convert
 	* @param type the type to convert to
-	* @return a variant with the proper representation of data as type
 	*/
-	TokenData convert(const TokenData& data, Tokens type) const;
+	void convert(Token& t, Tokens type) const;
+
+
+	/**
+	* Looks a variable up by name from the current scope down to the global one
+	* Argument names are found in the innermost frame that has the argument, unless a binding of the name is made inside that frame
+	* @return the variable or nullptr if it is not declared. Valid until the next binding or scope is made
+	*/
+	Token* find(Symbol name);
+
+	/**
+	* Looks up the variable a reference names. A reference with an inline cache site first tries the binding it last resolved to
+	* That binding is still the right one if it has the same name and no later binding hides it, otherwise the name is looked up again
+	* @return the variable or nullptr if it is not declared. Valid until the next binding or scope is made
+	*/
+	Token* find(const Token& var);
+
+	/**
+	* Declares a variable in the current scope, unless it is already declared there
+	* @param slot    the slot of the current scope the variable is stored in or -1 to store it in the binding
+	* @return the variable. Valid until the next binding or scope is made
+	*/
+	Token& bind(Symbol name, int slot = -1);
+
+	inline Token& valueOf(binding& b) {
+		return b.slot >= 0 ? slots[b.slot] : b.value;
+	}
+
+	/**@return the argument at a position of a frame or nullptr if s is not a frame or has no such argument*/
+	inline Token* argument(const scope& s, long position) {
+		if (position == symbols::lengthPosition && s.argc >= 0) return &slots[s.args + s.argc];
+		return position < s.argc ? &slots[s.args + position] : nullptr;
+	}
+
+	/**
+	* Looks up a lit_arg. The resolver only gives them to blocks that do not declare the name, so the frame of the current scope has it if it has the argument
+	* Otherwise the block was not run by exec or was passed fewer arguments, and the name is looked up as scoping is dynamic
+	* @return the argument or nullptr if it is not declared. Valid until the next binding or scope is made
+	*/
+	Token* argument(const Token& t);
 
+	/**@return the value of a slot of the current scope*/
+	inline Token& slot(const Token& t) {
+		return slots[scopes.back().slots + t.getInt()];
+	}
+
+	/**@return the value of t if it is a variable, otherwise t. Unlike evalLit, stored code is not run*/
+	inline Token variableValue(Token& t) {
+		return t.getType() == Tokens::lit_var || t.getType() == Tokens::lit_slot || t.getType() == Tokens::lit_arg ? evalLit(t) : t;
+	}
+
+	/**
+	* Evaluates an assignment. The variable gets the value of the right operand, not the operand itself
+	* @param t    the variable, the value and the operator
+	* @return the value or invalid on error
+	*/
+	Token assign(std::span<Token> t);
 
 	/**
 	* Evaluates an operator expression
+	* Operators other than = are done by the kernel for the operator and the types of the operands. See Operators.h
 	* Requires t be in postfix order
 	* @param t an array of arguments with the last being the operation
 	* @return a token result or invalid on error
 	*/
-	Token evalOp(std::vector<Token>& t);
+	Token evalOp(std::span<Token> t);
 
 	/**
 	* Evaluates a function expression
@@ -79,7 +203,7 @@ private:
 	* @param t an array of arguments with the last being the operation
 	* @return a token result or invalid on error
 	*/
-	Token evalFunc(std::vector<Token>& t);
+	Token evalFunc(std::span<Token> t);
 
 	/**
 	* Evaluates an keyword expression
@@ -87,7 +211,7 @@ private:
 	* @param t an array of arguments with the last being the operation
 	* @return a token result or invalid on error
 	*/
-	Token evalKeys(std::vector<Token>& t);
+	Token evalKeys(std::span<Token> t);
 
 	/**
 	* Resolves all tokens. Replaces variables with their value and executes stored code
@@ -95,9 +219,11 @@ private:
 	* Resulting value is stored in-place
 	* @param t an array of tokens. Non literals will not be changed
 	*/
-	inline void resolveLiterals(std::vector<Token>& t) {
-		for (Token& t : t)
-			t = evalLit(t);
+	inline void resolveLiterals(std::span<Token> t) {
+		for (Token& t : t) {
+			if (t.getType() == Tokens::lit_var || t.getType() == Tokens::lit_slot || t.getType() == Tokens::lit_arg || t.getType() == Tokens::lit_code)
+				t = evalLit(t);
+		}
 	}
 
 	/**
@@ -105,41 +231,6 @@ private:
 	* @param t an array of arguments with the last being the control flow keyword
 	* @return a token result or invalid
 	*/
-	Token evalControl(std::vector<Token>& t);
-
-
-
-
-#define MATH_OPERATOR(NAME) \
-	Token NAME(TokenData&& a, TokenData&& b, Tokens type) const
-	//OPERATORS -----------------------------------------------------------------------------------------
-	/**
-	* For all operator functions
-	* Requires that a and b be of type type
-	* @param a, b, c ... or list    the operands
-	* @param type    the type of the operands
-	* @return the resulting object of the operation or invalid if error
-	*/
-	Token add(TokenData&& a, TokenData&& b, Tokens type) const;
-
-	MATH_OPERATOR(sub);
-	MATH_OPERATOR(div);
-	MATH_OPERATOR(mul);
-	MATH_OPERATOR(power);
-	MATH_OPERATOR(test);
-	MATH_OPERATOR(bool_and);
-	MATH_OPERATOR(bool_or);
-	MATH_OPERATOR(bit_and);
-	MATH_OPERATOR(bit_or);
-	MATH_OPERATOR(bit_xor);
-	MATH_OPERATOR(mod);
-	MATH_OPERATOR(less);
-	MATH_OPERATOR(greater);
-	MATH_OPERATOR(less_eq);
-	MATH_OPERATOR(greater_eq);
-	MATH_OPERATOR(shift_left);
-	MATH_OPERATOR(shift_right);
-	MATH_OPERATOR(not_test);
-	MATH_OPERATOR(bool_xor);
+	Token evalControl(std::span<Token> t);
 };
 
@@ -0,0 +1,196 @@
+#pragma once
+//Operator kernels: one function for each operator and pair of operand types, generated from templates
+//The kernels live in a table indexed by the operator and the types of the operands, so an operation is one indirect call
+#include <array>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "Tokens.h"
+namespace operators {
+	//Values of each operand tag. Tags follow the order of the literal tokens, so the wider of two types has the larger tag
+	using Types = std::tuple<short, long, long long, float, double, std::string_view>;
+	constexpr size_t typeCount = std::tuple_size_v<Types>;
+	//Tag of a token that is not a number or a string
+	constexpr size_t notOperand = typeCount;
+	constexpr size_t opCount = (size_t)Tokens::op_bool_xor - (size_t)Tokens::op_plus + 1;
+
+	//Symbol of each operator, for errors
+	constexpr std::array<const char*, opCount> names = {
+		"+", "*", "-", "/", "**", "==", "=", ">", ">=", "<", "<=", "||", "&&", "|", "&", "^", "%", "<<", ">>", "!=", "^^"
+	};
+
+	using Kernel = Token(*)(const TokenData& a, const TokenData& b, std::string& error);
+
+	/**@return the tag of a literal type or notOperand*/
+	constexpr size_t tag(Tokens type) {
+		return (size_t)type - (size_t)Tokens::lit_short < typeCount ? (size_t)type - (size_t)Tokens::lit_short : notOperand;
+	}
+
+	/**@return the tag of the value of t or notOperand. The tag comes from the value itself, so it always matches what the kernel reads*/
+	inline size_t tag(const Token& t) {
+		constexpr std::array<size_t, 7> kinds = { 5, 4, 3, 2, 1, 0, notOperand }; //indexed by TokenData::Kind
+		if (tag(t.getType()) == notOperand) return notOperand;
+		return kinds[(size_t)t.getData().getKind()];
+	}
+
+	constexpr Tokens typeOf(size_t tag) {
+		return (Tokens)((uint16_t)Tokens::lit_short + tag);
+	}
+
+	/**@return true if op is an operator with a kernel*/
+	constexpr bool hasKernel(Tokens op) {
+		return (size_t)op - (size_t)Tokens::op_plus < opCount;
+	}
+
+	constexpr const char* name(Tokens op) {
+		return names[(size_t)op - (size_t)Tokens::op_plus];
+	}
+
+	template<Tokens Op>
+	constexpr bool comparison = Op == Tokens::op_test || Op == Tokens::op_ne || Op == Tokens::op_gr || Op == Tokens::op_gre
+		|| Op == Tokens::op_le || Op == Tokens::op_lee;
+
+	//Strings can be added and compared. Numbers support every operator but assignment, which evalOp never dispatches
+	template<Tokens Op, typename T>
+	constexpr bool supports = std::is_arithmetic_v<T> ? Op != Tokens::op_eq : Op == Tokens::op_plus || comparison<Op>;
+
+	/**@return v as a T. Numbers become strings by their shortest representation*/
+	template<typename T, typename V>
+	inline auto promote(V v) {
+		if constexpr (std::is_same_v<T, std::string_view> && !std::is_same_v<V, std::string_view>) return numberString(v);
+		else return (T)v;
+	}
+
+	//The result of Op on two values of the same arithmetic type. Bitwise operators and shifts work on long long, % of floating point values is fmod
+	template<Tokens Op, typename T>
+	inline T apply(T x, T y) {
+		using I = long long;
+		if constexpr (Op == Tokens::op_plus) return (T)(x + y);
+		else if constexpr (Op == Tokens::op_minus) return (T)(x - y);
+		else if constexpr (Op == Tokens::op_mul) return (T)(x * y);
+		else if constexpr (Op == Tokens::op_div) return (T)(x / y);
+		else if constexpr (Op == Tokens::op_exp) return (T)pow(x, y);
+		else if constexpr (Op == Tokens::op_test) return (T)(x == y);
+		else if constexpr (Op == Tokens::op_ne) return (T)(x != y);
+		else if constexpr (Op == Tokens::op_gr) return (T)(x > y);
+		else if constexpr (Op == Tokens::op_gre) return (T)(x >= y);
+		else if constexpr (Op == Tokens::op_le) return (T)(x < y);
+		else if constexpr (Op == Tokens::op_lee) return (T)(x <= y);
+		else if constexpr (Op == Tokens::op_or) return (T)(x || y);
+		else if constexpr (Op == Tokens::op_and) return (T)(x && y);
+		else if constexpr (Op == Tokens::op_bool_xor) return (T)((x || y) && (!x || !y));
+		else if constexpr (Op == Tokens::op_bit_or) return (T)((I)x | (I)y);
+		else if constexpr (Op == Tokens::op_bit_and) return (T)((I)x & (I)y);
+		else if constexpr (Op == Tokens::op_xor) return (T)((I)x ^ (I)y);
+		else if constexpr (Op == Tokens::op_mod) {
+			if constexpr (std::is_floating_point_v<T>) return (T)std::fmod(x, y);
+			else return y == -1 ? (T)0 : (T)((I)x % (I)y); //the least value % -1 traps on most machines
+		}
+		else if constexpr (Op == Tokens::op_sh_left) return (T)((I)x << (I)y);
+		else return (T)((I)x >> (I)y);
+	}
+
+	//Comparisons of strings give an int
+	template<Tokens Op>
+	inline long compare(std::string_view x, std::string_view y) {
+		if constexpr (Op == Tokens::op_test) return x == y;
+		else if constexpr (Op == Tokens::op_ne) return x != y;
+		else if constexpr (Op == Tokens::op_gr) return x > y;
+		else if constexpr (Op == Tokens::op_gre) return x >= y;
+		else if constexpr (Op == Tokens::op_le) return x < y;
+		else return x <= y;
+	}
+
+	/**@return the type of the result of Op on values of tags A and B or invalid if it is always an error*/
+	template<Tokens Op, size_t A, size_t B>
+	constexpr Tokens resultOf() {
+		constexpr size_t P = A > B ? A : B;
+		using T = std::tuple_element_t<P, Types>;
+		if constexpr (!supports<Op, T>) return Tokens::invalid;
+		else if constexpr (std::is_same_v<T, std::string_view> && comparison<Op>) return Tokens::lit_int;
+		else return typeOf(P);
+	}
+
+	/**
+	* Computes a Op b. Both are promoted to the wider of their two types, which is the type of the result
+	* Requires that a holds the type of tag A and b the type of tag B
+	* @param error    set if the operation fails
+	* @return the result or invalid on error
+	*/
+	template<Tokens Op, size_t A, size_t B>
+	Token kernel(const TokenData& a, const TokenData& b, std::string& error) {
+		constexpr size_t P = A > B ? A : B;
+		using T = std::tuple_element_t<P, Types>;
+		if constexpr (resultOf<Op, A, B>() == Tokens::invalid) {
+			error = "Type id " + std::to_string((uint16_t)typeOf(P)) + " unsupported as an operand for operator '" + name(Op) + "'";
+			return Tokens::invalid;
+		}
+		else {
+			const auto x = promote<T>(a.as<std::tuple_element_t<A, Types>>());
+			const auto y = promote<T>(b.as<std::tuple_element_t<B, Types>>());
+			if constexpr (std::is_integral_v<T> && (Op == Tokens::op_div || Op == Tokens::op_mod)) {
+				if (y == 0) {
+					error = std::string("Integer division by zero with operator '") + name(Op) + "'";
+					return Tokens::invalid;
+				}
+				if (Op == Tokens::op_div && y == -1 && x == std::numeric_limits<T>::min()) {
+					error = std::string("Integer overflow with operator '") + name(Op) + "'";
+					return Tokens::invalid;
+				}
+			}
+			if constexpr (std::is_same_v<T, std::string_view>) {
+				if constexpr (Op == Tokens::op_plus) {
+					Token res = Tokens::lit_str;
+					res.setVar(TokenData::concat(x, y));
+					return res;
+				}
+				else {
+					Token res = Tokens::lit_int;
+					res.setData(compare<Op>(x, y));
+					return res;
+				}
+			}
+			else {
+				Token res = typeOf(P);
+				res.setData(apply<Op, T>(x, y));
+				return res;
+			}
+		}
+	}
+
+	constexpr size_t tableSize = opCount * typeCount * typeCount;
+
+	/**Requires that hasKernel(op) and that neither tag is notOperand. @return the index of the kernel for op and operands of tags a and b*/
+	constexpr size_t index(Tokens op, size_t a, size_t b) {
+		return (((size_t)op - (size_t)Tokens::op_plus) * typeCount + a) * typeCount + b;
+	}
+
+	template<size_t I>
+	constexpr Tokens opAt() {
+		return (Tokens)((uint16_t)Tokens::op_plus + I / (typeCount * typeCount));
+	}
+
+	template<size_t... I>
+	constexpr std::array<Kernel, sizeof...(I)> makeKernels(std::index_sequence<I...>) {
+		return { &kernel<opAt<I>(), I / typeCount % typeCount, I % typeCount>... };
+	}
+
+	template<size_t... I>
+	constexpr std::array<Tokens, sizeof...(I)> makeResults(std::index_sequence<I...>) {
+		return { resultOf<opAt<I>(), I / typeCount % typeCount, I % typeCount>()... };
+	}
+
+	//Kernel of each operator and pair of tags, at index(op, a, b)
+	inline constexpr std::array<Kernel, tableSize> table = makeKernels(std::make_index_sequence<tableSize>());
+	//Type each kernel gives, for inferring types before code runs
+	inline constexpr std::array<Tokens, tableSize> results = makeResults(std::make_index_sequence<tableSize>());
+
+	/**Requires that hasKernel(op) and that neither tag is notOperand*/
+	inline Kernel find(Tokens op, size_t a, size_t b) {
+		return table[index(op, a, b)];
+	}
+}
@@ -0,0 +1,382 @@
+#include "Optimizer.h"
+#include "Evaluator.h"
+#include "CodePage.h"
+#include <span>
+#include <unordered_map>
+#include <unordered_set>
+#include <algorithm>
+/**
+* Computes a node whose operands are all constant
+* @param args    the values of the children followed by the token of the node
+* @return the value of the node or invalid if it can't be computed ahead of time
+*/
+static Token compute(std::vector<Token>& args, Evaluator& e)
+{
+	try {
+		return e.evaluate(args);
+	}
+	catch (std::exception&) {
+		return Tokens::invalid;
+	}
+}
+
+void foldConstants(ParseTree& tree, Evaluator& e)
+{
+	const FlatTree& flat = tree.finish();
+	const uint32_t size = flat.size();
+	std::vector<Token> values(size);
+	std::vector<bool> constant(size), replaced(size); //replaced nodes are added as their value
+	std::vector<Token> args;
+	for (uint32_t n = 0; n < size; ++n) {
+		const uint32_t* children = flat.children.data() + flat.firstChild[n];
+		const uint32_t count = flat.childCounts[n];
+		const Tokens type = flat.types[n];
+		bool operandsConstant = true;
+		for (uint32_t i = 0; i < count; ++i) operandsConstant = operandsConstant && constant[children[i]];
+		if (Evaluator::lazy(type) && count > 1 && constant[children[0]]) {
+			Token first = values[children[0]], v;
+			if (e.decides(first, type, v)) { //the other operands would never run
+				if (v.getType() != Tokens::invalid) {
+					values[n] = std::move(v);
+					constant[n] = replaced[n] = true;
+				}
+				continue;
+			}
+		}
+		switch (categoryOf(type)) {
+		case TokenCategory::literals:
+			if (count == 0 && type != Tokens::lit_var && type != Tokens::lit_code && type != Tokens::lit_slot && type != Tokens::lit_arg) {
+				values[n] = flat.token(n);
+				constant[n] = true;
+			}
+			continue;
+		case TokenCategory::operators:
+			if (type == Tokens::op_eq || !operandsConstant) continue;
+			break;
+		case TokenCategory::keywords:
+		case TokenCategory::functions:
+			if (count != 0 || (type != Tokens::kw_true && type != Tokens::kw_false && type != Tokens::func_lil_endian)) continue;
+			break;
+		default:
+			continue;
+		}
+		args.clear();
+		for (uint32_t i = 0; i < count; ++i) args.push_back(values[children[i]]);
+		args.push_back(flat.token(n));
+		Token v = compute(args, e);
+		if (v.getType() != Tokens::invalid) {
+			values[n] = std::move(v);
+			constant[n] = replaced[n] = true;
+		}
+	}
+	//a node is dropped if it is below a replaced node. Parents come after their children so this visits them first
+	std::vector<bool> dropped(size);
+	for (uint32_t n = size; n-- > 0;) {
+		if (!dropped[n] && !replaced[n]) continue;
+		for (uint32_t i = 0; i < flat.childCounts[n]; ++i) dropped[flat.children[flat.firstChild[n] + i]] = true;
+	}
+	ParseTree folded;
+	for (uint32_t n = 0; n < size; ++n) {
+		if (dropped[n]) continue;
+		if (replaced[n]) folded.addNode(values[n], 0);
+		else folded.addNode(flat.token(n), flat.childCounts[n]);
+	}
+	tree = std::move(folded);
+}
+
+/**@return the first node of the subtree of n. The subtree is the nodes from there to n, as they are in postorder*/
+static uint32_t subtreeStart(const FlatTree& flat, uint32_t n)
+{
+	while (flat.childCounts[n] > 0) n = flat.children[flat.firstChild[n]];
+	return n;
+}
+
+/**@return true if the subtree of n only reads variables: it holds only literals other than stored code, variables and operators other than =*/
+static bool readsOnly(const FlatTree& flat, uint32_t n)
+{
+	for (uint32_t i = subtreeStart(flat, n); i <= n; ++i) {
+		const Tokens type = flat.types[i];
+		if (flat.childCounts[i] == 0 ? categoryOf(type) != TokenCategory::literals || type == Tokens::lit_code
+			: !operators::hasKernel(type) || type == Tokens::op_eq) return false;
+	}
+	return true;
+}
+
+bool inlineBody(std::vector<ParseTree>& block, ParseTree& body)
+{
+	if (block.size() != 1) return false;
+	const FlatTree* flat;
+	try {
+		flat = &block[0].finish();
+	}
+	catch (evaluator_exception&) {
+		return false;
+	}
+	const uint32_t root = flat->root();
+	if (flat->types[root] != Tokens::kw_return || flat->childCounts[root] != 1) return false;
+	const uint32_t e = flat->children[flat->firstChild[root]], start = subtreeStart(*flat, e);
+	if (e - start + 1 > inlineLimit || flat->types[e] == Tokens::lit_var || !readsOnly(*flat, e)) return false;
+	for (uint32_t n = start; n <= e; ++n) body.addNode(flat->token(n), flat->childCounts[n]);
+	return true;
+}
+
+/**@return the argument of a call that a body node stands for, or -1 if it is not args_i of an argument the call has*/
+static long argumentOf(const Token& t, uint32_t argc)
+{
+	if (t.getType() != Tokens::lit_var) return -1;
+	const int32_t position = symbols::argumentPosition(t.getSymbol());
+	return position >= 0 && (uint32_t)position < argc ? position : -1;
+}
+
+/**@return the inline body of the call at node n or nullptr if it is not an exec that can be inlined*/
+static const FlatTree* inlinedBody(const FlatTree& flat, uint32_t n, CodePage& code)
+{
+	if (flat.types[n] != Tokens::kw_exec || flat.childCounts[n] == 0) return nullptr;
+	const uint32_t* children = flat.children.data() + flat.firstChild[n];
+	const uint32_t argc = flat.childCounts[n] - 1;
+	if (flat.types[children[0]] != Tokens::lit_code || flat.childCounts[children[0]] != 0) return nullptr;
+	const FlatTree* body = code.body(flat.token(children[0]));
+	if (body == nullptr) return nullptr;
+	for (uint32_t i = 0; i < argc; ++i)
+		if (!readsOnly(flat, children[i + 1])) return nullptr;
+	//nodes of the body that only run when the first operand of an &&, || or if above them does not decide it
+	std::vector<bool> conditional(body->size());
+	for (uint32_t b = body->size(); b-- > 0;) {
+		for (uint32_t c = 0; c < body->childCounts[b]; ++c)
+			conditional[body->children[body->firstChild[b] + c]] = conditional[b] || (c > 0 && Evaluator::lazy(body->types[b]));
+	}
+	//a computed argument has to run exactly once and before anything else that can fail, as the call computes its arguments first, in order
+	std::vector<uint32_t> uses(argc);
+	long next = 0; //first computed argument the body may still use
+	bool computing = false; //whether an operator of the body has been reached
+	for (uint32_t b = 0; b < body->size(); ++b) {
+		const long arg = argumentOf(body->token(b), argc);
+		if (arg < 0) {
+			computing = computing || body->childCounts[b] > 0;
+			continue;
+		}
+		++uses[arg];
+		if (flat.childCounts[children[arg + 1]] == 0) continue;
+		if (computing || conditional[b] || arg < next) return nullptr;
+		next = arg + 1;
+	}
+	for (uint32_t i = 0; i < argc; ++i)
+		if (flat.childCounts[children[i + 1]] > 0 && uses[i] != 1) return nullptr;
+	return body;
+}
+
+/**
+* Adds the nodes first to last of flat to out, replacing each call that starts there with its body
+* @param calls    for the callee of each call being inlined, the node of the call, otherwise noPayload
+*/
+static void addInlined(const FlatTree& flat, uint32_t first, uint32_t last, const std::vector<uint32_t>& calls, CodePage& code, ParseTree& out)
+{
+	for (uint32_t n = first; n <= last; ++n) {
+		if (calls[n] == FlatTree::noPayload) {
+			out.addNode(flat.token(n), flat.childCounts[n]);
+			continue;
+		}
+		//the callee is the first node of the call, so the call starts here
+		const uint32_t call = calls[n];
+		const uint32_t* args = flat.children.data() + flat.firstChild[call] + 1;
+		const uint32_t argc = flat.childCounts[call] - 1;
+		const FlatTree& body = *code.body(flat.token(n));
+		for (uint32_t b = 0; b < body.size(); ++b) {
+			Token t = body.token(b);
+			const long arg = argumentOf(t, argc);
+			if (arg >= 0) addInlined(flat, subtreeStart(flat, args[arg]), args[arg], calls, code, out);
+			else if (t.getType() == Tokens::lit_var && symbols::argumentPosition(t.getSymbol()) == symbols::lengthPosition) {
+				t = Tokens::lit_int;
+				t.setData((long)argc);
+				out.addNode(t, 0);
+			}
+			else out.addNode(t, body.childCounts[b]);
+		}
+		n = call;
+	}
+}
+
+void inlineCalls(ParseTree& tree, CodePage& code)
+{
+	const FlatTree& flat = tree.finish();
+	std::vector<uint32_t> calls(flat.size(), FlatTree::noPayload);
+	bool any = false;
+	for (uint32_t n = 0; n < flat.size(); ++n) {
+		if (inlinedBody(flat, n, code) == nullptr) continue;
+		calls[flat.children[flat.firstChild[n]]] = n;
+		any = true;
+	}
+	if (!any) return;
+	ParseTree inlined;
+	addInlined(flat, 0, flat.root(), calls, code, inlined);
+	tree = std::move(inlined);
+}
+
+/**@return the variable declared at the root of a statement, as in decl x or decl x = 5, or nullptr*/
+static const Token* declaration(const FlatTree& flat)
+{
+	uint32_t n = flat.root();
+	if (flat.types[n] == Tokens::op_eq && flat.childCounts[n] == 2) n = flat.children[flat.firstChild[n]];
+	if (flat.types[n] != Tokens::kw_decl || flat.childCounts[n] != 1) return nullptr;
+	n = flat.children[flat.firstChild[n]];
+	return flat.types[n] == Tokens::lit_var && flat.childCounts[n] == 0 ? &flat.literals[flat.payloads[n]] : nullptr;
+}
+
+std::vector<Symbol> resolveSlots(std::vector<ParseTree>& block)
+{
+	std::vector<const FlatTree*> statements;
+	std::unordered_set<Symbol> declared; //names declared anywhere in the block, which hide arguments of the same name
+	for (ParseTree& statement : block) {
+		try {
+			statements.push_back(&statement.finish());
+		}
+		catch (evaluator_exception&) {
+			break;
+		}
+		const FlatTree& flat = *statements.back();
+		for (uint32_t n = 0; n < flat.size(); ++n) {
+			if (flat.types[n] != Tokens::kw_decl || flat.childCounts[n] != 1) continue;
+			const uint32_t c = flat.children[flat.firstChild[n]];
+			if (flat.types[c] == Tokens::lit_var && flat.childCounts[c] == 0) declared.insert(flat.literals[flat.payloads[c]].getSymbol());
+		}
+	}
+	std::vector<Symbol> slots;
+	std::unordered_map<Symbol, long> bound; //slot of each name declared so far
+	for (size_t s = 0; s < statements.size(); ++s) {
+		const FlatTree& flat = *statements[s];
+		const Token* decl = declaration(flat);
+		if (decl != nullptr && bound.emplace(decl->getSymbol(), (long)slots.size()).second)
+			slots.push_back(decl->getSymbol());
+		ParseTree resolved;
+		bool changed = false;
+		for (uint32_t n = 0; n < flat.size(); ++n) {
+			Token t = flat.token(n);
+			if (t.getType() == Tokens::lit_var) {
+				const Symbol name = t.getSymbol();
+				auto slot = bound.find(name);
+				const long position = symbols::argumentPosition(name);
+				if (slot != bound.end()) {
+					t.setType(Tokens::lit_slot);
+					t.setData(slot->second);
+					changed = true;
+				}
+				else if (position >= 0 && !declared.contains(name)) {
+					t.setType(Tokens::lit_arg);
+					t.setData(position);
+					changed = true;
+				}
+			}
+			resolved.addNode(t, flat.childCounts[n]);
+		}
+		if (changed) block[s] = std::move(resolved);
+	}
+	return slots;
+}
+
+/**@return the type a node gives when it runs if it is known from the types of its children, otherwise invalid*/
+static Tokens nodeType(const FlatTree& flat, uint32_t n, const std::vector<Tokens>& types, const std::vector<Tokens>& slots)
+{
+	const uint32_t* children = flat.children.data() + flat.firstChild[n];
+	const uint32_t count = flat.childCounts[n];
+	const Tokens type = flat.types[n];
+	if (count == 0) {
+		if (type == Tokens::lit_slot) {
+			const size_t slot = (size_t)flat.token(n).getInt();
+			return slot < slots.size() ? slots[slot] : Tokens::invalid;
+		}
+		const size_t tag = flat.payloads[n] == FlatTree::noPayload ? operators::notOperand : operators::tag(flat.literals[flat.payloads[n]]);
+		return tag == operators::notOperand ? Tokens::invalid : operators::typeOf(tag);
+	}
+	if (type == Tokens::op_eq) return count == 2 ? types[children[1]] : Tokens::invalid;
+	if (count != 2 || !operators::hasKernel(type)) return Tokens::invalid;
+	const Tokens a = types[children[0]], b = types[children[1]];
+	if (a == Tokens::invalid || b == Tokens::invalid) return Tokens::invalid;
+	if (Evaluator::lazy(type) && a != b) return Tokens::invalid; //a decided result has the type of the first operand alone
+	return operators::results[operators::index(type, operators::tag(a), operators::tag(b))];
+}
+
+std::vector<Tokens> inferTypes(const FlatTree& flat)
+{
+	std::vector<Tokens> types(flat.size());
+	for (uint32_t n = 0; n < flat.size(); ++n) types[n] = nodeType(flat, n, types, {});
+	return types;
+}
+
+/**@return the slot an assignment writes to or -1 if it is not a slot. The target is the slot itself or decl of the slot*/
+static long assignedSlot(const FlatTree& flat, uint32_t n)
+{
+	if (flat.types[n] != Tokens::op_eq || flat.childCounts[n] != 2) return -1;
+	n = flat.children[flat.firstChild[n]];
+	if (flat.types[n] == Tokens::kw_decl && flat.childCounts[n] == 1) n = flat.children[flat.firstChild[n]];
+	return flat.types[n] == Tokens::lit_slot && flat.childCounts[n] == 0 ? flat.token(n).getInt() : -1;
+}
+
+std::vector<std::vector<Tokens>> inferTypes(std::vector<ParseTree>& block)
+{
+	std::vector<const FlatTree*> statements;
+	for (ParseTree& statement : block) {
+		try {
+			statements.push_back(&statement.finish());
+		}
+		catch (evaluator_exception&) {
+			break;
+		}
+	}
+	size_t slotCount = 0;
+	bool runsCode = false; //other code could assign to the slots by name
+	for (const FlatTree* flat : statements) {
+		for (uint32_t n = 0; n < flat->size(); ++n) {
+			const Tokens type = flat->types[n];
+			if (type == Tokens::lit_slot && flat->childCounts[n] == 0) slotCount = std::max(slotCount, (size_t)flat->token(n).getInt() + 1);
+			runsCode = runsCode || type == Tokens::kw_exec || type == Tokens::lit_code || categoryOf(type) == TokenCategory::control_flow;
+		}
+	}
+	//a slot has a type if it is declared with a value of that type and every assignment to it gives the same type
+	//A slot that turns out not to is unknown from then on, and the types are inferred again until none change
+	std::vector<bool> unknown(slotCount, runsCode);
+	std::vector<std::vector<Tokens>> types(statements.size());
+	for (bool changed = true; changed;) {
+		changed = false;
+		std::vector<Tokens> declared(slotCount, Tokens::invalid), visible(slotCount, Tokens::invalid);
+		for (size_t s = 0; s < statements.size(); ++s) {
+			const FlatTree& flat = *statements[s];
+			std::vector<Tokens>& t = types[s];
+			t.assign(flat.size(), Tokens::invalid);
+			for (uint32_t n = 0; n < flat.size(); ++n) t[n] = nodeType(flat, n, t, visible);
+			if (flat.size() == 0) continue;
+			const uint32_t root = flat.root();
+			long declares = assignedSlot(flat, root);
+			if (declares >= 0 && flat.types[flat.children[flat.firstChild[root]]] != Tokens::kw_decl) declares = -1;
+			if (declares >= 0 && declared[declares] == Tokens::invalid) declared[declares] = t[root];
+			for (uint32_t n = 0; n < flat.size(); ++n) {
+				const long slot = assignedSlot(flat, n);
+				if (slot < 0 || unknown[slot] || (t[n] != Tokens::invalid && t[n] == declared[slot])) continue;
+				unknown[slot] = changed = true;
+			}
+			if (declares >= 0) visible[declares] = unknown[declares] ? Tokens::invalid : declared[declares];
+		}
+	}
+	return types;
+}
+
+void cacheSites(std::vector<ParseTree>& block)
+{
+	static uint32_t next = 1; //0 means no site
+	for (ParseTree& statement : block) {
+		const FlatTree* flat;
+		try {
+			flat = &statement.finish();
+		}
+		catch (evaluator_exception&) {
+			break;
+		}
+		ParseTree cached;
+		for (uint32_t n = 0; n < flat->size(); ++n) {
+			Token t = flat->token(n);
+			if (t.getType() == Tokens::lit_var && symbols::argumentPosition(t.getSymbol()) < 0) //arguments are not bindings, see Evaluator::find
+				t.setData(t.getSymbol(), next++);
+			cached.addNode(t, flat->childCounts[n]);
+		}
+		statement = std::move(cached);
+	}
+}
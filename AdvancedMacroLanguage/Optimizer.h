@@ -0,0 +1,71 @@
+#pragma once
+//Optimization passes run on finished parse trees before they are compiled
+//Each pass rebuilds the tree, so the compilers and the stored code only see the result
+#include <vector>
+#include "ParseTree.h"
+
+/**
+* Replaces every subtree whose value is known when it is parsed with a literal of that value
+* Literals, true, false and isLittleEndian are constant, as is an operator (other than =) whose operands are all constant
+* Operators are computed by the Evaluator, so they give the same result as when they are run
+* &&, || and if are replaced by their result when their first operand is constant and decides it, as the rest would never run
+* Subtrees that fail to compute are kept so the error is reported when they run
+* @param e    the evaluator to compute with. Only its operator functions are used, so no variables or code are touched
+* @throw evaluator_exception if the tree is incomplete
+*/
+void foldConstants(ParseTree& tree, class Evaluator& e) throw(evaluator_exception);
+
+//Largest expression, in nodes, that a block can return and still be inlined
+constexpr uint32_t inlineLimit = 16;
+
+/**
+* Checks whether a block can be inlined at exec calls: it is a single return (E) where E has at most inlineLimit nodes and only reads variables
+* E may only hold literals other than stored code, variables and operators other than =, so it runs no other code and cannot be recursive
+* E must not be a variable itself, as the call would then become something that can be assigned to
+* Must be called before resolveSlots, which binds the arguments of the block to its frame
+* @param body    set to E if the block can be inlined
+* @return whether the block can be inlined
+*/
+bool inlineBody(std::vector<ParseTree>& block, ParseTree& body);
+
+/**
+* Replaces each exec of a block literal that the CodePage holds an inline body for with that body, see inlineBody
+* args_i becomes the i-th argument and args_length its number of arguments. args_i past the arguments is kept, so it is looked up as before
+* An argument must only read variables as the body does. One that is not a literal or variable is computed where the body uses it, so it must be used exactly once,
+* outside the operands of &&, || and if that may be skipped, and before any operator of the body and any later computed argument, so it fails when the call would have
+* The body then runs in the scope of the caller rather than its own. It declares nothing, so its names resolve the same
+* @throw evaluator_exception if the tree is incomplete
+*/
+void inlineCalls(ParseTree& tree, class CodePage& code) throw(evaluator_exception);
+
+/**
+* Binds the variables a block declares itself to slots of its scope, so they are read and written by index instead of by name
+* A statement declares a variable when its root is decl x or decl x = ... From that statement on, x in the block becomes a lit_slot
+* args_0, args_1 ... and args_length become a lit_arg unless the block declares the name, so a block run by exec reads them from its frame by position
+* Every other variable depends on where the block is run from, as scoping is dynamic, so it is still looked up by name
+* Stops at the first incomplete statement, as nothing after it runs
+* @return the name of each slot
+*/
+std::vector<Symbol> resolveSlots(std::vector<ParseTree>& block);
+
+/**
+* Gives every variable of a block that is still looked up by name its own inline cache site, see Evaluator::find
+* Stored code runs many times, so each reference remembers the binding it last resolved to and only looks the name up again when that binding no longer holds it
+*/
+void cacheSites(std::vector<ParseTree>& block);
+
+/**
+* Infers the type of each node of an expression that is known before it runs, so the compilers can pick the operator kernel ahead of time
+* Literals have their own type and an operator with a kernel has the type its kernel gives for the types of its operands, see Operators.h
+* && and || only have a type if both operands have the same one, as a decided result has the type of the first operand
+* @return the type of each node in the order of the tree or invalid where it depends on the values at run time
+*/
+std::vector<Tokens> inferTypes(const FlatTree& flat);
+
+/**
+* Infers the types of the nodes of a block whose variables are bound to slots by resolveSlots
+* A slot has a type when it is declared as decl x = value and every assignment to it gives a value of that same type
+* Slots have no type in a block that runs other code (exec, stored code or control flow), as that code could assign to them by name
+* @return the types of the nodes of each statement, up to the first incomplete one
+*/
+std::vector<std::vector<Tokens>> inferTypes(std::vector<ParseTree>& block);
@@ -1,10 +1,9 @@
 #pragma once
 #include "CheapPtr.h"
 #include "Tokens.h"
-#ifdef _DEBUG
 #include <functional>
-#endif
-#include <stack>
+#include <vector>
+#include <stdint.h>
 class evaluator_exception : public std::exception
 {
 private:
@@ -16,79 +15,68 @@ public:
 		return m.c_str();
 	}
 };
+/**
+* Flat layout of a finished parse tree
+* Nodes are stored in postorder (the order they are evaluated in) in parallel arrays and referred to by 32 bit indices
+* The root is the last node
+*/
+struct FlatTree {
+	static constexpr uint32_t noPayload = UINT32_MAX;
+	std::vector<Tokens> types;
+	std::vector<uint32_t> payloads; //index into literals for literal and void nodes, otherwise noPayload
+	std::vector<uint32_t> firstChild; //index into children of the first child of each node
+	std::vector<uint32_t> childCounts;
+	std::vector<uint32_t> children; //the child lists of every node, each in order
+	std::vector<Token> literals;
+
+	inline uint32_t size() const { return (uint32_t)types.size(); }
+	inline uint32_t root() const { return size() - 1; }
+	/**@return the token of node n*/
+	inline Token token(uint32_t n) const { return payloads[n] == noPayload ? Token(types[n]) : literals[payloads[n]]; }
+};
 //AST for the language
+//Built in postorder by the Parser: each node is added after its children
 class ParseTree
 {
-	//Invariants: root and next != nullptr
+	//Invariant: every index in pending is a node of flat without a parent
 private:
-	struct node;
-	node* root;
-	node* next; //the node that will be set on the next addToken() call
-	std::stack<node*> subtrees; //when inside an expression () or block {}
+	FlatTree flat;
+	std::vector<uint32_t> pending; //roots of the subtrees that have not been given a parent yet
 public:
-	ParseTree();
-	~ParseTree();
+	ParseTree() = default;
 	ParseTree(const ParseTree& other) = delete;
 	ParseTree& operator=(const ParseTree& other) = delete;
-	ParseTree(ParseTree&& other);
-	ParseTree& operator=(ParseTree&& other);
+	ParseTree(ParseTree&& other) = default;
+	ParseTree& operator=(ParseTree&& other) = default;
 
 	/**
-	* Adds a new token to the tree
-	* Tree ordering is online
+	* Adds a node to the tree
+	* @param children    the amount of the most recently added subtrees that become the children of the node, in the order they were added
 	*/
-	void addToken(const Token& t);
+	void addNode(const Token& t, uint32_t children);
 
 	/**
 	* Evaluates the tree from the root
+	* Visits the nodes in postorder with a stack of values, passing the values of each node's children and its data in postfix order to the evaluator
+	* The nodes of the operands of &&, || and if are skipped when the first operand decides the result
+	* @see Evaluator::evaluate
 	* @returns resultant Token of largest size
 	* @throw evaluator exception
 	*/
 	Token evaluate(class Evaluator& e) throw(evaluator_exception);
+
+	/**
+	* Checks that the tree is complete
+	* Called by evaluate. No nodes can be added after the tree is finished
+	* @return the flat layout of the tree
+	* @throw evaluator_exception if the tree does not have exactly one root
+	*/
+	const FlatTree& finish() throw(evaluator_exception);
 #ifdef _DEBUG
 	void inorderTraversal(std::function<void(const Token&)> f) const;
 #endif
 private:
-	
-	/**
-	* Moves to the parent of n
-	* If n is the root, creates a new root and makes n its left child
-	* Bubbles up and preserves the isSubTree property
-	*If n is the root of the subtree, follows the same process as if it were the root
-	*/
-	void moveUp(node* n);
-
-	/**
-	* Moves down the tree to the child on n
-	* Creates a new node if necessary
-	* @param childIndex    which child to move to. If childIndex >= children.size(), creates more children. If index == -1, moves down the next null child
-	*/
-	void moveDown(node* n, int childIndex = -1);
-
-	//requires pivot is left child of parent
-	void rotateRight(node* pivot);
-	//pivot is right child of parent
-	void rotateLeft(node* pivot);
 #ifdef _DEBUG
-	void inorder(node* n, std::function<void(const Token&)>& f) const;
+	void inorder(uint32_t n, std::function<void(const Token&)>& f) const;
 #endif
-
-	/**@return  root of the deepest active subtreee. If no subtree is "open", returns the root*/
-	node* getSubTreeRoot() const;
-
-	/**
-	* Performs a postorder depth-first transversal of the tree and at each node passes the evaluation of its children and its data in postfix order to the evaluator
-	* @see Evaluator::evaluate
-	* @throw evaluator_exception on error
-	*/
-	Token evaluate(node* n, class Evaluator& e) throw(evaluator_exception);
-
-	/**
-	* Performs a single left or right rotation as necessary to put the node in the correct spot
-	* Will check node and its children, left than right. Only does one rotation so call again to ensure both children are ordered correctly
-	* @param parent    the node to check. Will check this nodes children
-	* @return the new root of the subtree or next if nothing changed
-	*/
-	node* balanceNode(node* parent);
 };
-
@@ -0,0 +1,142 @@
+#include "Parser.h"
+#include "CodePage.h"
+#include "Optimizer.h"
+ParseTree Parser::statement()
+{
+	ParseTree pt;
+	tree = &pt;
+	blockDepth = 0;
+	nesting = 0;
+	try {
+		expression();
+		expect(Tokens::end_stment);
+		inlineCalls(pt, code);
+		foldConstants(pt, folder);
+	}
+	catch (parse_exception&) {
+		recover();
+		throw;
+	}
+	return pt;
+}
+
+void Parser::expression(int minPrecedence)
+{
+	if (++nesting > maxNesting) throw parse_exception("Expression nested deeper than " + std::to_string(maxNesting) + " levels");
+	prefix();
+	while (true) {
+		Tokens op = peek().getType();
+		int p = precedence(op);
+		if (categoryOf(op) != TokenCategory::operators || p <= minPrecedence) break;
+		next();
+		expression(rightAssociative(op) ? p - 1 : p);
+		tree->addNode(op, 2);
+	}
+	--nesting;
+}
+
+void Parser::prefix()
+{
+	const Token& t = peek();
+	switch (t.getCategory()) {
+	case TokenCategory::literals:
+		tree->addNode(next(), 0);
+		return;
+	case TokenCategory::functions:
+	case TokenCategory::keywords:
+	case TokenCategory::control_flow:
+	{
+		Token op = next();
+		uint32_t args = 0;
+		if (op.getType() == Tokens::kw_decl) { //decl x = 5 declares x, then assigns to it
+			prefix();
+			args = 1;
+		}
+		else if (startsExpression(peek())) {
+			do {
+				expression();
+				++args;
+			} while (accept(Tokens::sx_comma));
+		}
+		tree->addNode(op, args);
+		return;
+	}
+	case TokenCategory::syntax:
+		if (accept(Tokens::start_expr)) {
+			expression();
+			expect(Tokens::end_expr);
+			return;
+		}
+		else if (accept(Tokens::start_block)) {
+			tree->addNode(block(), 0);
+			return;
+		}
+	default:
+		break;
+	}
+	throw unexpected();
+}
+
+Token Parser::block()
+{
+	ParseTree* outer = tree;
+	std::vector<ParseTree> statements;
+	++blockDepth;
+	while (!accept(Tokens::end_block)) {
+		statements.emplace_back();
+		tree = &statements.back();
+		expression();
+		if (!accept(Tokens::end_stment) && peek().getType() != Tokens::end_block) throw unexpected();
+		inlineCalls(statements.back(), code);
+		foldConstants(statements.back(), folder);
+	}
+	--blockDepth;
+	tree = outer;
+	return code.add(std::move(statements));
+}
+
+bool Parser::startsExpression(const Token& t)
+{
+	switch (t.getCategory()) {
+	case TokenCategory::literals:
+	case TokenCategory::functions:
+	case TokenCategory::keywords:
+	case TokenCategory::control_flow:
+		return true;
+	default:
+		return t.getType() == Tokens::start_expr || t.getType() == Tokens::start_block;
+	}
+}
+
+void Parser::expect(Tokens t)
+{
+	if (!accept(t)) {
+		if (peek().getType() == Tokens::invalid) throw unexpected();
+		throw parse_exception(std::string("Expected '") + tokenizer.reverseLookup(t) + "' but found " + describe(peek()));
+	}
+}
+
+parse_exception Parser::unexpected()
+{
+	if (peek().getType() == Tokens::invalid)
+		return parse_exception("Invalid token: '" + tokenizer.getInvalidToken() + "'");
+	return parse_exception("Unexpected token: " + describe(peek()));
+}
+
+std::string Parser::describe(const Token& t) const
+{
+	if (t.getCategory() == TokenCategory::literals)
+		return "'" + t.literalValue() + "'";
+	return std::string("'") + tokenizer.reverseLookup(t.getType()) + "'";
+}
+
+void Parser::recover()
+{
+	while (peek().getType() != Tokens::invalid) {
+		Tokens t = next().getType();
+		if (t == Tokens::start_block) ++blockDepth;
+		else if (t == Tokens::end_block) --blockDepth;
+		else if (t == Tokens::end_stment && blockDepth <= 0) return;
+	}
+	peeked = false; //the invalid token was already consumed by the tokenizer
+}
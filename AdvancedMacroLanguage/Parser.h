@@ -0,0 +1,88 @@
+#pragma once
+//Precedence climbing (Pratt) parser
+//Reads tokens from the Tokenizer and builds each statement's ParseTree in one pass, adding every node after its children
+//Finished trees have small blocks inlined at exec calls and are constant folded before they are returned or stored
+#include "ParseTree.h"
+#include "Tokenizer.h"
+class parse_exception : public std::exception
+{
+private:
+	std::string m;
+public:
+	parse_exception(const std::string& s) : m(s) {}
+	parse_exception(const std::string&& s) : m(s) {}
+	const char* what() const override {
+		return m.c_str();
+	}
+};
+/**
+* Grammar:
+*	statement  := expression ';'
+*	expression := prefix (binary-operator expression)*    operators bind by precedence(), = and ** group from the right
+*	prefix     := literal | '(' expression ')' | block | 'decl' prefix | function [expression (',' expression)*]
+*	block      := '{' (expression (';' | before '}'))* '}'    stored in the CodePage, the node is its lit_code token
+* Functions, keywords and control flow take the longest argument list that follows them, so print a + b, c is print((a + b), c)
+*/
+class Parser
+{
+private:
+	Tokenizer& tokenizer;
+	class CodePage& code;
+	class Evaluator& folder; //computes constant subtrees
+	ParseTree* tree; //tree of the statement being parsed
+	Token lookahead;
+	bool peeked; //lookahead holds the next token
+	int blockDepth; //blocks open at the current token
+	int nesting; //expressions being parsed. Each is a native call so this is limited to maxNesting
+public:
+	Parser(Tokenizer& tokenizer, class CodePage& code, class Evaluator& folder) : tokenizer(tokenizer), code(code), folder(folder), tree(nullptr), peeked(false), blockDepth(0), nesting(0) {}
+
+	static constexpr int maxNesting = 1000;
+
+	/**
+	* Parses a statement up to and including its ';'. Blocks in the statement are added to the CodePage
+	* On error, skips the rest of the statement unless the error was an invalid token
+	* @throw parse_exception on invalid or unexpected tokens or expressions nested deeper than maxNesting
+	*/
+	ParseTree statement() throw(parse_exception);
+private:
+	//Adds the nodes for an expression whose operators bind tighter than minPrecedence
+	void expression(int minPrecedence = 0);
+
+	void prefix();
+
+	/**Parses the statements of a block after its '{' and stores it in the CodePage. @return the lit_code token for the block*/
+	Token block();
+
+	/**@return true if t can be the first token of an expression*/
+	static bool startsExpression(const Token& t);
+
+	inline const Token& peek() {
+		if (!peeked) {
+			lookahead = tokenizer.getToken();
+			peeked = true;
+		}
+		return lookahead;
+	}
+	inline Token next() {
+		peek();
+		peeked = false;
+		return lookahead;
+	}
+	//Consumes the next token if it is of type t
+	inline bool accept(Tokens t) {
+		if (peek().getType() != t) return false;
+		peeked = false;
+		return true;
+	}
+	void expect(Tokens t) throw(parse_exception);
+
+	/**@return an exception for the next token, which is not consumed*/
+	parse_exception unexpected();
+
+	/**@return the token as it is written, quoted*/
+	std::string describe(const Token& t) const;
+
+	//Skips tokens up to the end of the statement that had an error
+	void recover();
+};
@@ -1,11 +1,118 @@
 #define _CRT_SECURE_NO_WARNINGS
 #include "Stream.h"
 #include <string>
+#include <cstring>
+#include <algorithm>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
 Stream make_stream(const char* uri, streamMode mode) {
 	if (strstr(uri, "std"))
 		return { mode == streamMode::input ? stdin : stdout };
 	else {
-		return { fopen(uri, mode == streamMode::input ? "r" : "w") };
+		return { fopen(uri, mode == streamMode::input ? "r" : "w"), true };
 	}
 
-}
\ No newline at end of file
+}
+constexpr size_t blockSize = 1 << 16;
+//Regions smaller than this are cheaper to write through the stdio buffer than with a flush and a system call
+constexpr size_t minKernelCopy = 1 << 14;
+
+InputBuffer::InputBuffer(Stream& in) : buf(nullptr), len(0), pos(0), mapped(false), fd(-1)
+{
+#ifndef _WIN32 //text mode streams on windows translate line endings, so those are always read through stdio
+	struct stat info;
+	if (fstat(fileno(in), &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+		void* m = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fileno(in), 0);
+		if (m != MAP_FAILED) {
+#ifdef MADV_SEQUENTIAL
+			madvise(m, (size_t)info.st_size, MADV_SEQUENTIAL);
+#endif
+			buf = (const char*)m;
+			len = (size_t)info.st_size;
+			mapped = true;
+			if (in.isFile) fd = fileno(in);
+			return;
+		}
+	}
+#endif
+	size_t read;
+	do {
+		owned.resize(len + blockSize);
+		read = fread(owned.data() + len, 1, blockSize, in);
+		len += read;
+	} while (read == blockSize);
+	owned.resize(len);
+	buf = owned.data();
+}
+
+InputBuffer::~InputBuffer()
+{
+#ifndef _WIN32
+	if (mapped) munmap((void*)buf, len);
+#endif
+}
+
+size_t InputBuffer::findMarker(char sym) const
+{
+	size_t i = tell();
+	while (i < len) {
+		const char* found = (const char*)memchr(buf + i, sym, len - i);
+		if (found == nullptr) return len;
+		i = found - buf;
+		if (i + 1 < len && buf[i + 1] == sym) return i;
+		i += 2; //the character after sym is not part of a marker either
+	}
+	return len;
+}
+
+size_t InputBuffer::countLines(size_t begin, size_t end) const
+{
+	return std::count(buf + begin, buf + std::min(end, len), '\n');
+}
+
+Passthrough::Passthrough(const InputBuffer& in, Stream& out) : in(in), out(out), mode(copyMode::buffered)
+{
+#ifdef __linux__
+	struct stat info;
+	if (in.descriptor() != -1 && out.isFile && fstat(fileno(out), &info) == 0) {
+		if (S_ISREG(info.st_mode)) mode = copyMode::copy_range;
+		else if (S_ISFIFO(info.st_mode)) mode = copyMode::splice;
+	}
+#endif
+}
+
+void Passthrough::write(size_t begin, size_t end)
+{
+	if (mode != copyMode::buffered && end - begin >= minKernelCopy) {
+		fflush(out); //anything the evaluator printed must come first
+		begin += kernelCopy(begin, end);
+	}
+	fwrite(in.data() + begin, 1, end - begin, out);
+}
+
+size_t Passthrough::kernelCopy(size_t begin, size_t end)
+{
+	size_t written = 0;
+#ifdef __linux__
+	loff_t offset = (loff_t)begin;
+	while (begin + written < end) {
+		ssize_t n = mode == copyMode::copy_range ?
+			copy_file_range(in.descriptor(), &offset, fileno(out), nullptr, end - begin - written, 0) :
+			splice(in.descriptor(), &offset, fileno(out), nullptr, end - begin - written, 0);
+		if (n > 0) written += n;
+		else if (n < 0 && errno == EINTR) continue;
+		else { //unsupported by the kernel or file system (EXDEV, EINVAL, ENOSYS...), stop trying
+			mode = copyMode::buffered;
+			break;
+		}
+	}
+#endif
+	return written;
+}
@@ -1,11 +1,14 @@
 #pragma once
 #include <stdio.h>
+#include <stddef.h>
+#include <vector>
 enum class streamMode {
 	input, output
 };
 //RAII for FILE*
 struct Stream {
 	FILE* str;
+	bool isFile; //opened from a path by make_stream rather than stdin/stdout
 	~Stream() {
 		if (str != nullptr) fclose(str);
 	}
@@ -14,14 +17,88 @@ struct Stream {
 	Stream(const Stream& other) = delete;
 	Stream(Stream&& other) noexcept {
 		str = other.str;
+		isFile = other.isFile;
 		other.str = nullptr;
 	}
 	Stream& operator=(Stream&& other) noexcept {
 		if (str != nullptr) fclose(str);
 		str = other.str;
+		isFile = other.isFile;
 		other.str = nullptr;
 		return *this; 
 	}
-	Stream(FILE* str) : str(str) {};
+	Stream(FILE* str, bool isFile = false) : str(str), isFile(isFile) {};
+};
+Stream make_stream(const char* uri, streamMode mode);
+
+/**
+* The entire input held in memory with a read cursor
+* Regular files are memory mapped (except on windows), anything else (stdin, pipes) is read in large blocks
+* Replaces per character fgetc/ungetc calls for both the interpreter loop and the Tokenizer
+*/
+class InputBuffer
+{
+	//Invariant: buf is valid for len bytes. pos may pass len by the amount of reads done at the end of the input
+private:
+	const char* buf;
+	size_t len;
+	size_t pos;
+	bool mapped;
+	int fd; //descriptor of the mapped file if the input is a file opened by make_stream, otherwise -1
+	std::vector<char> owned; //backing storage when the input could not be mapped
+public:
+	InputBuffer(Stream& in);
+	~InputBuffer();
+	InputBuffer(const InputBuffer& other) = delete;
+	InputBuffer& operator=(const InputBuffer& other) = delete;
+
+	/**@return the next character and advances the cursor or EOF if there are no characters left*/
+	inline int get() { return pos++ < len ? (unsigned char)buf[pos - 1] : EOF; }
+	/**Moves the cursor back by one. Requires that get() was called at least once since the cursor was last moved*/
+	inline void unget() { --pos; }
+
+	inline bool eof() const { return pos >= len; }
+	inline size_t tell() const { return pos < len ? pos : len; }
+	inline void seek(size_t p) { pos = p; }
+	inline const char* data() const { return buf; }
+	inline size_t size() const { return len; }
+	/**@return the descriptor of the input file, where offsets into data() are offsets into the file, or -1*/
+	inline int descriptor() const { return fd; }
+
+	/**
+	* Finds the next directive marker (two consecutive sym characters) at or after the cursor
+	* @return the index of the marker or size() if there is none
+	*/
+	size_t findMarker(char sym) const;
+
+	/**@return the amount of newlines in the range [begin, end)*/
+	size_t countLines(size_t begin, size_t end) const;
+};
+
+/**
+* Copies regions of the input to the output between directives
+* When both the input and output are files opened by make_stream, the data is moved by the kernel
+* (copy_file_range, or splice if the output is a pipe) and is never copied into user space
+* Otherwise, or if the kernel refuses the copy, falls back to buffered writes
+*/
+class Passthrough
+{
+private:
+	enum class copyMode {
+		buffered, copy_range, splice
+	};
+	const InputBuffer& in;
+	Stream& out;
+	copyMode mode;
+public:
+	Passthrough(const InputBuffer& in, Stream& out);
+
+	/**Writes the input region [begin, end) to the output*/
+	void write(size_t begin, size_t end);
+private:
+	/**
+	* Moves the region through the kernel
+	* @return the amount of bytes that were written. If less than requested, mode has been set to buffered
+	*/
+	size_t kernelCopy(size_t begin, size_t end);
 };
-Stream make_stream(const char* uri, streamMode mode);
\ No newline at end of file
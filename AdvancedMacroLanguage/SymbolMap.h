@@ -0,0 +1,111 @@
+#pragma once
+//Open addressing hash table keyed on symbols, for the variable index of the Evaluator
+//Entries are stored inline in one array with their hash beside them, so a lookup touches one or two cache lines and needs no allocation per entry
+//Robin Hood probing: an entry further from its home position takes the place of one closer to its own, which keeps probe sequences short and even
+#include <vector>
+#include <utility>
+#include <stdint.h>
+#include "Symbols.h"
+template<typename V>
+class SymbolMap
+{
+	//Invariant: entries.size() is 0 or a power of 2 and count is at most 3/4 of it
+private:
+	struct entry {
+		uint32_t hash; //0 if the entry is empty
+		Symbol key;
+		V value;
+	};
+	std::vector<entry> entries;
+	size_t count;
+
+	inline size_t mask() const { return entries.size() - 1; }
+	/**@return how far the entry at i is from its home position*/
+	inline size_t distance(size_t i) const { return (i - (entries[i].hash & mask())) & mask(); }
+
+	/**Requires that key is not in the table and there is room for it. @return the entry it was placed in*/
+	size_t place(uint32_t hash, Symbol key, V value) {
+		size_t placed = entries.size();
+		for (size_t i = hash & mask(), d = 0;; i = (i + 1) & mask(), ++d) {
+			if (entries[i].hash == 0) {
+				entries[i] = { hash, key, std::move(value) };
+				return placed == entries.size() ? i : placed;
+			}
+			const size_t existing = distance(i);
+			if (existing < d) { //the entry here is closer to home, so it moves on instead
+				std::swap(hash, entries[i].hash);
+				std::swap(key, entries[i].key);
+				std::swap(value, entries[i].value);
+				if (placed == entries.size()) placed = i;
+				d = existing;
+			}
+		}
+	}
+
+	/**@return the entry of key or entries.size() if it is not in the table*/
+	size_t indexOf(Symbol key) const {
+		if (entries.empty()) return 0;
+		const uint32_t hash = hashOf(key);
+		for (size_t i = hash & mask(), d = 0;; i = (i + 1) & mask(), ++d) {
+			const entry& e = entries[i];
+			if (e.hash == 0 || distance(i) < d) return entries.size(); //key would have displaced this entry
+			if (e.hash == hash && e.key == key) return i;
+		}
+	}
+
+	void grow() {
+		std::vector<entry> old = std::move(entries);
+		entries.assign(old.empty() ? 16 : old.size() * 2, entry{ 0, 0, V() });
+		for (entry& e : old)
+			if (e.hash != 0) place(e.hash, e.key, std::move(e.value));
+	}
+public:
+	SymbolMap() : count(0) {}
+
+	/**@return a well mixed, nonzero hash of a symbol. Symbols are numbered in order, so they are mixed before use. The low bits are the home position*/
+	static inline uint32_t hashOf(Symbol key) {
+		uint32_t h = key;
+		h ^= h >> 16;
+		h *= 0x85ebca6bu;
+		h ^= h >> 13;
+		h *= 0xc2b2ae35u;
+		h ^= h >> 16;
+		return h == 0 ? 1 : h;
+	}
+
+	/**@return the value of key or nullptr if it is not in the table. Valid until the next insertion or erasure*/
+	V* find(Symbol key) {
+		const size_t i = indexOf(key);
+		return i < entries.size() ? &entries[i].value : nullptr;
+	}
+
+	/**
+	* Inserts key with value if it is not in the table
+	* @return the value of key. Valid until the next insertion or erasure
+	*/
+	V& tryEmplace(Symbol key, const V& value) {
+		if (V* v = find(key)) return *v;
+		if ((count + 1) * 4 > entries.size() * 3) grow();
+		++count;
+		return entries[place(hashOf(key), key, value)].value;
+	}
+
+	/**
+	* Removes key if it is in the table
+	* The entries after it that are away from their home position move back one place, so no tombstones are left and probes stay as short as if key was never inserted
+	* @return true if key was in the table
+	*/
+	bool erase(Symbol key) {
+		size_t i = indexOf(key);
+		if (i == entries.size()) return false;
+		for (size_t next = (i + 1) & mask(); entries[next].hash != 0 && distance(next) != 0; i = next, next = (next + 1) & mask())
+			entries[i] = std::move(entries[next]);
+		entries[i] = entry{ 0, 0, V() };
+		--count;
+		return true;
+	}
+
+	inline size_t size() const { return count; }
+	//Number of entries, which is 0 or a power of 2
+	inline size_t capacity() const { return entries.size(); }
+};
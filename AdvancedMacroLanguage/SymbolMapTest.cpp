@@ -0,0 +1,178 @@
+//Checks the Robin Hood table of SymbolMap.h
+//Not part of the interpreter's project, as it has its own main: build it with every source but InterpreterMain.cpp and AllocationTest.cpp and run it with no arguments
+//Keys are picked by their home position, so entries collide, wrap around the end of the table and are shifted back when one before them is erased
+//Then a long run of random insertions and erasures is compared with std::unordered_map
+#include <cstdio>
+#include <vector>
+#include <unordered_map>
+#include "SymbolMap.h"
+static int failures = 0;
+
+static void check(bool ok, const char* what)
+{
+	if (!ok) {
+		++failures;
+		printf("FAILED: %s\n", what);
+	}
+}
+
+/**@return count keys from first on whose home position in a table of capacity entries is home*/
+static std::vector<Symbol> keysAt(size_t home, size_t capacity, size_t count, Symbol first = 1)
+{
+	std::vector<Symbol> keys;
+	for (Symbol key = first; keys.size() < count; ++key)
+		if ((SymbolMap<int>::hashOf(key) & (capacity - 1)) == home) keys.push_back(key);
+	return keys;
+}
+
+/**@return true if every key maps to its value*/
+static bool holds(SymbolMap<int>& map, const std::vector<Symbol>& keys, const std::vector<int>& values)
+{
+	for (size_t i = 0; i < keys.size(); ++i) {
+		const int* v = map.find(keys[i]);
+		if (v == nullptr || *v != values[i]) return false;
+	}
+	return true;
+}
+
+static void insertAndFind()
+{
+	SymbolMap<int> map;
+	check(map.find(7) == nullptr && !map.erase(7), "an empty table has no keys");
+	check(map.tryEmplace(7, 70) == 70 && map.size() == 1, "insert a key");
+	check(map.tryEmplace(7, 71) == 70 && map.size() == 1, "inserting a key again keeps its value");
+	map.tryEmplace(7, 0) = 72;
+	check(*map.find(7) == 72, "the value returned by tryEmplace is the stored one");
+	check(map.find(8) == nullptr, "find a missing key");
+}
+
+//Inserts until the table has doubled several times, checking every key each time it does
+static void rehash()
+{
+	SymbolMap<int> map;
+	std::vector<Symbol> keys;
+	std::vector<int> values;
+	size_t capacity = 0, growths = 0;
+	for (Symbol key = 1; key <= 5000; ++key) {
+		keys.push_back(key * 2654435761u);
+		values.push_back((int)key);
+		map.tryEmplace(keys.back(), values.back());
+		if (map.capacity() != capacity) {
+			capacity = map.capacity();
+			++growths;
+			check((capacity & (capacity - 1)) == 0, "the capacity is a power of 2");
+			check(holds(map, keys, values), "keys are found after the table grows");
+		}
+		check(map.size() * 4 <= map.capacity() * 3, "the table is at most 3/4 full");
+	}
+	check(growths >= 8, "the table grew several times");
+	check(map.size() == keys.size() && holds(map, keys, values), "keys are found after every insertion");
+	for (Symbol key = 1; key <= 5000; ++key)
+		check(map.find(key * 2654435761u + 1) == nullptr, "keys that were not inserted are missing");
+}
+
+//Keys that all have the same home position, and erasures from the middle of their run
+static void collisions()
+{
+	SymbolMap<int> map;
+	const std::vector<Symbol> keys = keysAt(5, 16, 10);
+	std::vector<int> values;
+	for (size_t i = 0; i < keys.size(); ++i) {
+		values.push_back((int)i);
+		map.tryEmplace(keys[i], values.back());
+	}
+	check(map.capacity() == 16, "colliding keys fit in the first table");
+	check(holds(map, keys, values), "colliding keys are found");
+	check(map.find(keysAt(5, 16, 1, keys.back() + 1)[0]) == nullptr, "a missing key with the same home is not found");
+
+	std::vector<Symbol> kept;
+	std::vector<int> keptValues;
+	for (size_t i = 0; i < keys.size(); ++i) {
+		if (i % 3 == 1) check(map.erase(keys[i]), "erase a colliding key");
+		else {
+			kept.push_back(keys[i]);
+			keptValues.push_back(values[i]);
+		}
+	}
+	check(map.size() == kept.size(), "erasing lowers the size");
+	check(holds(map, kept, keptValues), "keys after an erased one are shifted back and found");
+	for (size_t i = 1; i < keys.size(); i += 3) check(map.find(keys[i]) == nullptr && !map.erase(keys[i]), "erased keys are missing");
+	map.tryEmplace(keys[1], 100);
+	check(*map.find(keys[1]) == 100 && holds(map, kept, keptValues), "an erased key can be inserted again");
+}
+
+//Keys at the last positions, so their probes wrap around to the start of the table, mixed with keys at the first position
+static void wraparound()
+{
+	SymbolMap<int> map;
+	const std::vector<Symbol> last = keysAt(15, 16, 4), first = keysAt(0, 16, 3), before = keysAt(14, 16, 2);
+	std::vector<Symbol> keys;
+	std::vector<int> values;
+	for (const std::vector<Symbol>* group : { &first, &last, &before }) {
+		for (Symbol key : *group) {
+			keys.push_back(key);
+			values.push_back((int)keys.size());
+			map.tryEmplace(key, values.back());
+		}
+	}
+	check(map.capacity() == 16, "wrapped keys fit in the first table");
+	check(holds(map, keys, values), "keys are found across the end of the table");
+
+	//erasing at the end of the table shifts the entries at its start back across the end
+	check(map.erase(before[0]) && map.erase(last[0]), "erase keys at the end of the table");
+	keys.erase(keys.begin() + first.size() + last.size());
+	values.erase(values.begin() + first.size() + last.size());
+	keys.erase(keys.begin() + first.size());
+	values.erase(values.begin() + first.size());
+	check(holds(map, keys, values), "keys are shifted back across the end of the table and found");
+	check(map.erase(first[0]) && map.erase(first[1]) && map.erase(first[2]), "erase keys at the start of the table");
+	keys.erase(keys.begin(), keys.begin() + first.size());
+	values.erase(values.begin(), values.begin() + first.size());
+	check(holds(map, keys, values), "keys whose probes wrapped are found after those before them are erased");
+	check(map.size() == keys.size(), "the size counts the keys left");
+}
+
+//Random insertions, erasures and lookups compared with std::unordered_map. Insertions are most common at first, so the table grows, then erasures, so it empties out again
+static void randomOperations()
+{
+	SymbolMap<int> map;
+	std::unordered_map<Symbol, int> expected;
+	uint32_t state = 12345;
+	const auto next = [&state]() {
+		state = state * 1664525u + 1013904223u;
+		return state >> 8;
+	};
+	bool same = true;
+	for (int step = 0; step < 200000 && same; ++step) {
+		const Symbol key = next() % 3000;
+		const int value = (int)next();
+		const uint32_t roll = next() % 10, inserting = step < 100000 ? 5 : 1;
+		if (roll < inserting)
+			same = map.tryEmplace(key, value) == expected.try_emplace(key, value).first->second;
+		else if (roll < 7)
+			same = map.erase(key) == (expected.erase(key) == 1);
+		else {
+			const int* v = map.find(key);
+			const auto e = expected.find(key);
+			same = e == expected.end() ? v == nullptr : v != nullptr && *v == e->second;
+		}
+		same = same && map.size() == expected.size();
+	}
+	for (const auto& [key, value] : expected) same = same && map.find(key) != nullptr && *map.find(key) == value;
+	check(same, "random insertions and erasures agree with std::unordered_map");
+}
+
+int main()
+{
+	insertAndFind();
+	rehash();
+	collisions();
+	wraparound();
+	randomOperations();
+	if (failures != 0) {
+		printf("%d checks FAILED\n", failures);
+		return 1;
+	}
+	printf("passed\n");
+	return 0;
+}
@@ -0,0 +1,66 @@
+#include "Symbols.h"
+#include <deque>
+#include <unordered_map>
+#include <vector>
+namespace {
+	struct Entry {
+		std::string name;
+		int32_t position; //see argumentPosition
+	};
+	//Entries never move, so the keys of index can view their names
+	std::deque<Entry>& entries()
+	{
+		static std::deque<Entry> e;
+		return e;
+	}
+	std::unordered_map<std::string_view, Symbol>& index()
+	{
+		static std::unordered_map<std::string_view, Symbol> i;
+		return i;
+	}
+	int32_t positionOf(std::string_view name)
+	{
+		if (name == "args_length") return symbols::lengthPosition;
+		//only the names argument gives, so args_01 is not an argument
+		if (name.size() < 6 || name.size() > 14 || name.substr(0, 5) != "args_" || (name[5] == '0' && name.size() > 6)) return -1;
+		int32_t i = 0;
+		for (char c : name.substr(5)) {
+			if (c < '0' || c > '9') return -1;
+			i = i * 10 + (c - '0');
+		}
+		return i;
+	}
+}
+
+Symbol symbols::intern(std::string_view name)
+{
+	auto& i = index();
+	auto it = i.find(name);
+	if (it != i.end()) return it->second;
+	auto& e = entries();
+	e.push_back({ std::string(name), positionOf(name) });
+	return i.emplace(e.back().name, (Symbol)(e.size() - 1)).first->second;
+}
+
+const std::string& symbols::name(Symbol s)
+{
+	return entries()[s].name;
+}
+
+Symbol symbols::argsLength()
+{
+	static const Symbol s = intern("args_length");
+	return s;
+}
+
+Symbol symbols::argument(size_t i)
+{
+	static std::vector<Symbol> args;
+	while (args.size() <= i) args.push_back(intern("args_" + std::to_string(args.size())));
+	return args[i];
+}
+
+int32_t symbols::argumentPosition(Symbol s)
+{
+	return entries()[s].position;
+}
@@ -0,0 +1,23 @@
+#pragma once
+//Interned identifiers
+//The tokenizer gives every distinct variable name a symbol once, so scopes compare and hash names as integers
+#include <string>
+#include <string_view>
+#include <stdint.h>
+using Symbol = uint32_t;
+namespace symbols {
+	/**@return the symbol of name, adding it if this is the first time it is seen. Symbols are numbered from 0 in order*/
+	Symbol intern(std::string_view name);
+
+	/**Requires that s was returned by intern. @return the name of s*/
+	const std::string& name(Symbol s);
+
+	//Names of the arguments of exec, see Evaluator::newCall
+	Symbol argsLength(); //args_length
+	Symbol argument(size_t i); //args_i
+
+	//Position of args_length among the arguments, after every args_i
+	constexpr int32_t lengthPosition = INT32_MAX;
+	/**Requires that s was returned by intern. @return i if s is args_i, lengthPosition if it is args_length, otherwise -1*/
+	int32_t argumentPosition(Symbol s);
+}
@@ -0,0 +1,43 @@
+#include "TokenData.h"
+#include <string.h>
+TokenData::Text* TokenData::makeText(size_t size)
+{
+	Text* t = static_cast<Text*>(::operator new(sizeof(Text) + size));
+	t->refs = 1;
+	t->size = (uint32_t)size;
+	return t;
+}
+
+TokenData::TokenData(std::string_view v) : bits(0), kind(Kind::string)
+{
+	if (!v.empty()) {
+		text = makeText(v.size());
+		memcpy(text->chars(), v.data(), v.size());
+	}
+}
+
+TokenData TokenData::concat(std::string_view a, std::string_view b)
+{
+	TokenData r;
+	if (a.size() + b.size() > 0) {
+		r.text = makeText(a.size() + b.size());
+		if (!a.empty()) memcpy(r.text->chars(), a.data(), a.size());
+		if (!b.empty()) memcpy(r.text->chars() + a.size(), b.data(), b.size());
+	}
+	return r;
+}
+
+bool TokenData::operator==(const TokenData& other) const
+{
+	if (kind != other.kind) return false;
+	switch (kind) {
+	case Kind::string: return str() == other.str();
+	case Kind::dbl: return d == other.d;
+	case Kind::flt: return f == other.f;
+	case Kind::lng: return ll == other.ll;
+	case Kind::integer: return l == other.l;
+	case Kind::shrt: return s == other.s;
+	case Kind::symbol: return var.name == other.var.name;
+	}
+	return false;
+}
@@ -0,0 +1,137 @@
+#pragma once
+//The value carried by a Token
+//A 16 byte tagged union: an 8 byte payload and the kind of the payload
+//Strings point to a reference counted buffer that is never changed once made, so copying a value never allocates
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <utility>
+#include <stdint.h>
+#include "Symbols.h"
+class TokenData
+{
+public:
+	enum class Kind : uint8_t { string, dbl, flt, lng, integer, shrt, symbol };
+private:
+	//Immutable string shared by every copy of a value. The characters follow the header in the same allocation
+	struct Text {
+		uint32_t refs;
+		uint32_t size;
+		char* chars() { return reinterpret_cast<char*>(this + 1); }
+	};
+	union {
+		double d;
+		float f;
+		long long ll;
+		long l;
+		short s;
+		struct {
+			Symbol name;
+			uint32_t site; //inline cache of the variable reference, see Evaluator::find. 0 if it has none
+		} var;
+		Text* text; //nullptr for the empty string
+		uint64_t bits; //the whole payload, for copying
+	};
+	Kind kind;
+
+	static Text* makeText(size_t size);
+	inline void release() {
+		if (kind == Kind::string && text != nullptr && --text->refs == 0) ::operator delete(text);
+	}
+	template<typename T>
+	static constexpr Kind kindOf() {
+		if constexpr (std::is_same_v<T, double>) return Kind::dbl;
+		else if constexpr (std::is_same_v<T, float>) return Kind::flt;
+		else if constexpr (std::is_same_v<T, long long>) return Kind::lng;
+		else if constexpr (std::is_same_v<T, long>) return Kind::integer;
+		else if constexpr (std::is_same_v<T, short>) return Kind::shrt;
+		else if constexpr (std::is_same_v<T, Symbol>) return Kind::symbol;
+		else {
+			static_assert(std::is_same_v<T, std::string_view>, "TokenData holds numbers, symbols and strings (as std::string_view)");
+			return Kind::string;
+		}
+	}
+public:
+	//The empty string
+	TokenData() : bits(0), kind(Kind::string) {}
+	TokenData(double v) : d(v), kind(Kind::dbl) {}
+	TokenData(float v) : f(v), kind(Kind::flt) {}
+	TokenData(long long v) : ll(v), kind(Kind::lng) {}
+	TokenData(long v) : l(v), kind(Kind::integer) {}
+	TokenData(short v) : s(v), kind(Kind::shrt) {}
+	TokenData(Symbol v, uint32_t site = 0) : var{ v, site }, kind(Kind::symbol) {}
+	/**Copies the characters into a new buffer*/
+	TokenData(std::string_view v);
+	TokenData(const std::string& v) : TokenData(std::string_view(v)) {}
+	TokenData(const char* v) : TokenData(std::string_view(v)) {}
+
+	TokenData(const TokenData& other) : bits(other.bits), kind(other.kind) {
+		if (kind == Kind::string && text != nullptr) ++text->refs;
+	}
+	TokenData(TokenData&& other) noexcept : bits(other.bits), kind(other.kind) {
+		other.kind = Kind::lng; //other no longer owns a reference
+	}
+	TokenData& operator=(TokenData other) noexcept {
+		std::swap(bits, other.bits);
+		std::swap(kind, other.kind);
+		return *this;
+	}
+	~TokenData() { release(); }
+
+	/**@return a new string of a followed by b, made with one allocation*/
+	static TokenData concat(std::string_view a, std::string_view b);
+
+	inline Kind getKind() const { return kind; }
+
+	/**@return true if the value is a T. Strings are std::string_view*/
+	template<typename T>
+	inline bool holds() const { return kind == kindOf<T>(); }
+
+	/**
+	* @return the value as a T. Strings are std::string_view
+	* @throw std::bad_variant_access if the value is not a T
+	*/
+	template<typename T>
+	T get() const {
+		if (kind != kindOf<T>()) throw std::bad_variant_access();
+		return as<T>();
+	}
+
+	/**Requires that the value is a T. @return the value without checking its kind*/
+	template<typename T>
+	inline T as() const {
+		if constexpr (std::is_same_v<T, double>) return d;
+		else if constexpr (std::is_same_v<T, float>) return f;
+		else if constexpr (std::is_same_v<T, long long>) return ll;
+		else if constexpr (std::is_same_v<T, long>) return l;
+		else if constexpr (std::is_same_v<T, short>) return s;
+		else if constexpr (std::is_same_v<T, Symbol>) return var.name;
+		else return str();
+	}
+
+	/**Requires that the value is a symbol. @return its inline cache site or 0*/
+	inline uint32_t site() const { return var.site; }
+
+	/**Requires that the value is a string. @return a view of it, valid while a copy of this value exists*/
+	inline std::string_view str() const {
+		return text == nullptr ? std::string_view() : std::string_view(text->chars(), text->size);
+	}
+
+	/**Calls fn with the value as its own type. Strings are passed as std::string_view*/
+	template<typename F>
+	decltype(auto) visit(F&& fn) const {
+		switch (kind) {
+		case Kind::dbl: return fn(d);
+		case Kind::flt: return fn(f);
+		case Kind::lng: return fn(ll);
+		case Kind::integer: return fn(l);
+		case Kind::shrt: return fn(s);
+		case Kind::symbol: return fn(var.name);
+		default: return fn(str());
+		}
+	}
+
+	bool operator==(const TokenData& other) const;
+};
+static_assert(sizeof(TokenData) == 16, "TokenData is an 8 byte payload and a tag");
@@ -1,7 +1,10 @@
 #include "Tokenizer.h"
 #include "CompileTimeHash.h"
-#include <sstream>
-constexpr Tuple<const char*, Tokens> tokenList[] = {
+#include "CharClass.h"
+#include <algorithm>
+#include <array>
+#include <charconv>
+constexpr Tuple<std::string_view, Tokens> tokenList[] = {
     {"print", Tokens::func_print}, {"random", Tokens::func_rand}, {"exec", Tokens::kw_exec}, {"return", Tokens::kw_return}, {"+", Tokens::op_plus}, {"-", Tokens::op_minus}, {"/", Tokens::op_div},
     {"**", Tokens::op_exp}, {"*", Tokens::op_mul}, {"<", Tokens::op_le}, {"<=", Tokens::op_lee}, {">", Tokens::op_gr}, {">=", Tokens::op_gre},
     {"==", Tokens::op_test}, {"&&", Tokens::op_and}, {"||", Tokens::op_or}, {"|", Tokens::op_bit_or}, {"&", Tokens::op_bit_and}, {"%", Tokens::op_mod},
@@ -9,173 +12,221 @@ constexpr Tuple<const char*, Tokens> tokenList[] = {
     {"isLittleEndian", Tokens::func_lil_endian}, {"true", Tokens::kw_true}, {"false", Tokens::kw_false}, {"=", Tokens::op_eq}, {"decl", Tokens::kw_decl},
     {"if", Tokens::ct_if}
 };
-static constexpr CompileTimeHash<const char*, Tokens> tokenHash(tokenList, sizeof(tokenList) / sizeof(Tuple<const char *, Tokens>), Tokens::invalid);
+static constexpr auto tokenHash = makePerfectHash(tokenList, Tokens::invalid);
+
+constexpr bool allTokensFound() {
+    for (auto& token : tokenList)
+        if (!tokenHash.find(token.k)) return false;
+    return true;
+}
+static_assert(allTokensFound(), "tokenHash must find every entry of tokenList");
+
+//Reverse of tokenList, indexed by the category of a token then its position in the category
+constexpr size_t categoryCount = (size_t)TokenCategory::syntax + 1;
+constexpr size_t categoryWidth() {
+    size_t width = 0;
+    for (auto& token : tokenList) width = std::max(width, ((size_t)token.v & 0xFFF) + 1);
+    return width;
+}
+using ReverseTable = std::array<std::array<std::string_view, categoryWidth()>, categoryCount>;
+constexpr ReverseTable makeReverseTable() {
+    ReverseTable table{};
+    for (auto& token : tokenList)
+        table[(size_t)categoryOf(token.v)][(size_t)token.v & 0xFFF] = token.k;
+    return table;
+}
+static constexpr ReverseTable reverseTable = makeReverseTable();
+
+constexpr bool reverseTableValid() {
+    for (auto& token : tokenList)
+        if (reverseTable[(size_t)categoryOf(token.v)][(size_t)token.v & 0xFFF] != token.k) return false;
+    return true;
+}
+static_assert(reverseTableValid(), "Every token in tokenList must have exactly one name");
+
+/**Looks up a keyword, function or operator*/
+static inline Tokens lookup(const char* begin, size_t length)
+{
+    Tokens type;
+    return tokenHash.getifValid(std::string_view(begin, length), type) ? type : Tokens::invalid;
+}
+
+/**
+* Parses a number literal with std::from_chars
+* @return false if the text is not a valid number or is out of range for T
+*/
+template<typename T>
+static bool parseNumber(std::string_view text, Token& t)
+{
+    T value;
+    auto res = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (res.ec != std::errc() || res.ptr != text.data() + text.size()) return false;
+    t.setData(value);
+    return true;
+}
 
 Token Tokenizer::getToken()
 {
-    Token t;
-    char c = fgetc(input);
-    errorToken = c;
-    while (c != EOF && (c == ' ' || c == '\r' || c == '\n' || c == '\t')) //ignore leading whitespaces
-        c = fgetc(input);
-    if (c == '-' || isdigit(c) || c == '.') {
-        char buf[max_token_length + 1];
-        short i = 0;
-        bool floating = false;
-        if (c == '-') {
-            char c2 = fgetc(input);
-            if (isdigit(c2) || (c2 == '.' && (floating = true))) {
-                buf[i++] = c;
-                buf[i++] = c2;
-                c = fgetc(input);
-            }
-            else {
-                ungetc(c2, input);
-                goto handleOperators; //I think this is my first goto 
-            }
-        }
-        do {
-            buf[i++] = c;
-            c = fgetc(input);
-        } while (i < max_token_length && (isdigit(c) || (c == '.' && (floating = true)))); //sets floating to true if c == '.' Loops if c is a digit or c == '.'
-        buf[i] = '\0';
-        if (floating && c == 'f') {
-            t.setData(std::stof(buf));
-            t.setType(Tokens::lit_float);
-        }
-        else if (floating) {
-            t.setData(std::stod(buf));
-            t.setType(Tokens::lit_dbl);
-        }
-        else if (c == 'L') {
-            t.setData(std::stoll(buf));
-            t.setType(Tokens::lit_long);
-        }
-        else {
-            t.setData(std::stoi(buf));
-            t.setType(Tokens::lit_int);
-        }
-        if(c != 'f' && c != 'L') ungetc(c, input);
+    Lexeme l = nextLexeme();
+    Token t(l.type);
+    bool valid = true;
+    switch (l.type) {
+    case Tokens::lit_int:
+        valid = parseNumber<long>(text(l), t);
+        break;
+    case Tokens::lit_long:
+        valid = parseNumber<long long>(text(l), t);
+        break;
+    case Tokens::lit_float:
+        valid = parseNumber<float>(text(l), t);
+        break;
+    case Tokens::lit_dbl:
+        valid = parseNumber<double>(text(l), t);
+        break;
+    case Tokens::lit_str:
+        t.setData(std::string(text(l)));
+        break;
+    case Tokens::lit_var:
+        t.setData(symbols::intern(text(l)));
+        break;
+    default:
+        break;
+    }
+    if (!valid) {
+        errorToken = text(l);
+        t.setType(Tokens::invalid);
+    }
+    return t;
+}
+
+Lexeme Tokenizer::nextLexeme()
+{
+    const char* p = input.data() + input.tell();
+    const char* end = input.data() + input.size();
+    p = chars::skipSpace(p, end); //ignore leading whitespaces
+    if (p == end) {
+        errorToken = "EOF";
+        return make(Tokens::invalid, p, p);
+    }
+    char c = *p;
+    if (chars::is(c, chars::digit) || c == '.' || (c == '-' && p + 1 < end && (chars::is(p[1], chars::digit) || p[1] == '.')))
+        return scanNumber(p, end);
+    else if (chars::is(c, chars::quote))
+        return scanString(p + 1, end);
+    else if (isOperator(c))
+        return scanOperator(p, end);
+    else if (chars::is(c, chars::alpha))
+        return scanIdentifier(p, end);
+    switch (c) {
+    case '{': return make(Tokens::start_block, p, p + 1);
+    case '}': return make(Tokens::end_block, p, p + 1);
+    case ';': return make(Tokens::end_stment, p, p + 1);
+    case '(': return make(Tokens::start_expr, p, p + 1);
+    case ')': return make(Tokens::end_expr, p, p + 1);
+    case ',': return make(Tokens::sx_comma, p, p + 1);
+    default:
+        errorToken = c;
+        return make(Tokens::invalid, p, p + 1);
+    }
+}
 
+Lexeme Tokenizer::scanNumber(const char* p, const char* end)
+{
+    const char* begin = p;
+    bool floating = false;
+    if (*p == '-') ++p;
+    while ((p = chars::skipDigits(p, end)) < end && *p == '.') {
+        floating = true;
+        ++p;
     }
-    else if (c == '"' || c == '\'') {
-        std::stringstream ss;
-        char lastC = c;
-        bool escaped = false;
-        while ((c = fgetc(input)) != EOF && ((c != '"' && c != '\'') || lastC == '\\')) {
-            if(c != '\\' && lastC != '\\') ss << c;
-            if (lastC == '\\' && !escaped) {
-                switch (c) {
-                case 'n':
-                    ss << '\n';
-                    break;
-                case 't':
-                    ss << '\t';
-                    break;
-                case 'r':
-                    ss << '\r';
-                    break;
-                case '\\':
-                    ss << '\\';
-                    escaped = true;
-                    break;
-                case '\'':
-                    ss << '\'';
-                    break;
-                case '\"':
-                    ss << '"';
-                    break;
-                case 'v':
-                    ss << '\v';
-                    break;
-                case 'b':
-                    ss << '\b';
-                    break;
-                default:
-                    ss << c;
-                }
-            }
-            else if (lastC == '\\') {
-                ss << c;
-                escaped = false;
-            }
-            lastC = c;
-        } 
-        t.setData(ss.str());
-        t.setType(Tokens::lit_str);
+    Lexeme l = make(Tokens::lit_int, begin, p);
+    if (p < end && (*p == 'f' || *p == 'L')) { //suffix is not part of the literal's text
+        if (floating && *p == 'f') l.type = Tokens::lit_float;
+        else if (!floating && *p == 'L') l.type = Tokens::lit_long;
+        input.seek(p + 1 - input.data());
     }
-    else if (isOperator(c)){
-        handleOperators:
-        char buf[max_token_length + 1];
-        short i = 0;
-        do {
-            buf[i++] = c;
-            c = fgetc(input);
-        } while (i < max_token_length && c != EOF && isOperator(c));
-        buf[i] = '\0';
-        Tokens type;
-        t.setType(tokenHash.getifValid(buf, type) ? type : Tokens::invalid);
-        if (t.getType() == Tokens::invalid) errorToken = buf;
-        ungetc(c, input);
+    if (floating && l.type == Tokens::lit_int) l.type = Tokens::lit_dbl;
+    return l;
+}
+
+Lexeme Tokenizer::scanString(const char* p, const char* end)
+{
+    const char* begin = p;
+    p = chars::skipString(p, end);
+    if (p == end || *p != '\\') { //no escapes, the literal is the span itself
+        Lexeme l = make(Tokens::lit_str, begin, p);
+        if (p < end) input.seek(p + 1 - input.data()); //closing quote
+        return l;
     }
-    else if (isalpha(c)) {
-        char buf[max_token_length + 1];
-        short i = 0;
-        do {
-            buf[i++] = c;
-            c = fgetc(input);
-        } while (i < max_token_length && c != EOF && (isalnum(c) || c == '_'));
-        buf[i] = '\0';
-        Tokens type;
-        if (tokenHash.getifValid(buf, type)) {
-            t.setType(type);
-        }
-        else if (i == max_token_length && c != EOF && (isalnum(c) || c == '_')) {
-            t.setType(Tokens::invalid);
-            errorToken = buf;
+    unescaped.assign(begin, p);
+    while (p < end && !chars::is(*p, chars::quote)) {
+        if (*p != '\\') {
+            const char* run = chars::skipString(p, end);
+            unescaped.append(p, run);
+            p = run;
+            continue;
         }
-        else {
-            t.setType(Tokens::lit_var);
-            t.setData(buf);
+        if (++p == end) break;
+        switch (*p) {
+        case 'n':
+            unescaped += '\n';
+            break;
+        case 't':
+            unescaped += '\t';
+            break;
+        case 'r':
+            unescaped += '\r';
+            break;
+        case 'v':
+            unescaped += '\v';
+            break;
+        case 'b':
+            unescaped += '\b';
+            break;
+        default: //quotes, backslashes and unknown escapes are the character itself
+            unescaped += *p;
         }
-        ungetc(c, input);
+        ++p;
     }
-    else if (c == '{') t.setType(Tokens::start_block);
-    else if (c == '}') t.setType(Tokens::end_block);
-    else if (c == ';') t.setType(Tokens::end_stment);
-    else if (c == '(') t.setType(Tokens::start_expr);
-    else if (c == ')') t.setType(Tokens::end_expr);
-    else if (c == ',') t.setType(Tokens::sx_comma);
-    return t;
+    Lexeme l = make(Tokens::lit_str, begin, p, true);
+    if (p < end) input.seek(p + 1 - input.data());
+    return l;
+}
+
+Lexeme Tokenizer::scanOperator(const char* p, const char* end)
+{
+    const char* begin = p;
+    for (; p < end && chars::is(*p, chars::op); ++p);
+    Tokens type = lookup(begin, p - begin);
+    if (type == Tokens::invalid) errorToken.assign(begin, p);
+    return make(type, begin, p);
+}
+
+Lexeme Tokenizer::scanIdentifier(const char* p, const char* end)
+{
+    const char* begin = p;
+    p = chars::skipIdentifier(p, end);
+    Tokens type = lookup(begin, p - begin);
+    return make(type == Tokens::invalid ? Tokens::lit_var : type, begin, p);
 }
 bool Tokenizer::isOperator(char c)
 {
-    switch (c) {
-    case '*':
-    case '+':
-    case '-':
-    case '&':
-    case '!':
-    case '%':
-    case '^':
-    case '|':
-    case '=':
-    case '.':
-    case '>':
-    case '<':
-    case '/':
-        return true;
-    default:
-        return false;
-    }
+    return chars::is(c, chars::op);
 }
 
 const char* Tokenizer::reverseLookup(Tokens t) const
 {
-    for (auto& token : tokenList) {
-        if (token.v == t) return token.k;
+    switch (t) { //single character syntax tokens are scanned directly and are not in tokenList
+    case Tokens::start_block: return "{";
+    case Tokens::end_block: return "}";
+    case Tokens::end_stment: return ";";
+    case Tokens::start_expr: return "(";
+    case Tokens::end_expr: return ")";
+    case Tokens::sx_comma: return ",";
+    default:
+        break;
     }
-    return "";
+    const size_t category = (size_t)categoryOf(t), index = (size_t)t & 0xFFF;
+    if (category >= categoryCount || index >= categoryWidth() || reverseTable[category][index].data() == nullptr) return "";
+    return reverseTable[category][index].data(); //names are string literals so they are null terminated
 }
-
-
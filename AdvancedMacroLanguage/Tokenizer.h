@@ -2,13 +2,22 @@
 #include "Stream.h"
 #include "Tokens.h"
 #include <string>
+#include <string_view>
+//A token as a span of the source buffer. Does not own any memory
+struct Lexeme {
+	Tokens type;
+	size_t offset; //for string literals, the span is the text between the quotes
+	size_t length;
+	bool escaped; //string literal contains escape sequences. The decoded text is held by the Tokenizer until the next lexeme
+};
 class Tokenizer
 {
 private:
-	Stream& input;
+	InputBuffer& input;
 	std::string errorToken;
+	std::string unescaped; //decoded text of the last escaped string literal. Reused between literals
 public:
-	Tokenizer(Stream& in) : input(in) {}
+	Tokenizer(InputBuffer& in) : input(in) {}
 
 	/**
 	* Gets the next token from the stream
@@ -16,6 +25,18 @@ public:
 	* Token can be preceded by whitespace
 	*/
 	Token getToken();
+
+	/**
+	* Scans the next token from the input without allocating
+	* @see getToken
+	* @return the token as a span of the input. Type is invalid on error or at the end of the input
+	*/
+	Lexeme nextLexeme();
+
+	/**@return the text of the lexeme. Decoded for escaped strings, otherwise a view into the input*/
+	inline std::string_view text(const Lexeme& l) const {
+		return l.escaped ? std::string_view(unescaped) : std::string_view(input.data() + l.offset, l.length);
+	}
 	static bool isOperator(char c);
 
 	/**@return the string of characters that could not be indentified as a token*/
@@ -23,5 +44,26 @@ public:
 
 	//Gets the string for the token
 	const char* reverseLookup(Tokens t) const;
+private:
+	/**
+	* Scans a number literal starting at p
+	* @return the lexeme. A trailing 'f' or 'L' suffix is consumed but is not part of the lexeme
+	*/
+	Lexeme scanNumber(const char* p, const char* end);
+
+	/**Scans a string literal. p is the first character after the opening quote*/
+	Lexeme scanString(const char* p, const char* end);
+
+	/**Scans a run of operator characters starting at p and looks it up*/
+	Lexeme scanOperator(const char* p, const char* end);
+
+	/**Scans an identifier starting at p. Keywords and functions are looked up, anything else is a variable*/
+	Lexeme scanIdentifier(const char* p, const char* end);
+
+	/**@return lexeme of type with the span [begin, p) and moves the cursor to p*/
+	inline Lexeme make(Tokens type, const char* begin, const char* p, bool escaped = false) {
+		input.seek(p - input.data());
+		return { type, (size_t)(begin - input.data()), (size_t)(p - begin), escaped };
+	}
 };
 
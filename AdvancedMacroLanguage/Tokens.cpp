@@ -4,23 +4,56 @@ std::string Token::literalValue() const
 {
     switch (type) {
     case Tokens::lit_str:
+        return std::string(getStr());
     case Tokens::lit_var:
-        return getStr();
+        return symbols::name(getSymbol());
     case Tokens::lit_dbl:
-        return std::to_string(getDbl());
+        return numberString(getDbl());
     case Tokens::lit_float:
-        return std::to_string(getFlt());
+        return numberString(getFlt());
     case Tokens::lit_int:
-        return std::to_string(getInt());
+        return numberString(getInt());
     case Tokens::lit_long:
-        return std::to_string(getLng());
+        return numberString(getLng());
     case Tokens::lit_short:
-        return std::to_string(getShort());
+        return numberString(getShort());
     default:
         return "";
     }
 }
 
+void Token::print(FILE* out) const
+{
+    char buf[max_number_length];
+    char* end = buf;
+    switch (type) {
+    case Tokens::lit_str:
+        if (!getStr().empty()) fwrite(getStr().data(), 1, getStr().size(), out);
+        return;
+    case Tokens::lit_var:
+        fwrite(symbols::name(getSymbol()).data(), 1, symbols::name(getSymbol()).size(), out);
+        return;
+    case Tokens::lit_dbl:
+        end = formatNumber(buf, buf + max_number_length, getDbl());
+        break;
+    case Tokens::lit_float:
+        end = formatNumber(buf, buf + max_number_length, getFlt());
+        break;
+    case Tokens::lit_int:
+        end = formatNumber(buf, buf + max_number_length, getInt());
+        break;
+    case Tokens::lit_long:
+        end = formatNumber(buf, buf + max_number_length, getLng());
+        break;
+    case Tokens::lit_short:
+        end = formatNumber(buf, buf + max_number_length, getShort());
+        break;
+    default:
+        break;
+    }
+    fwrite(buf, 1, end - buf, out);
+}
+
 bool Token::operator==(const Token& other) const
 {
     return type == other.type && data == other.data;
@@ -3,7 +3,9 @@
 #include <variant>
 #include <memory>
 #include <type_traits>
-constexpr short max_token_length = 100;
+#include <charconv>
+#include <stdio.h>
+#include "TokenData.h"
 enum class TokenCategory { //must be <= 16 categories
 	functions, literals, operators, control_flow, keywords, syntax
 };
@@ -17,6 +19,8 @@ enum class Tokens : uint16_t {
 	lit_section_start = (uint16_t)TokenCategory::literals << 12, //sections to quickly determine what type of token something is
 	lit_var,
 	lit_code,
+	lit_slot, //a variable bound to a slot of the current scope by the resolver. Holds the slot as an int
+	lit_arg, //an argument of the exec call the current scope is the frame of, bound by the resolver. Holds its position as an int, see symbols::argumentPosition
 	lit_short,
 	lit_int,
 	lit_long,
@@ -78,38 +82,70 @@ enum class Tokens : uint16_t {
 constexpr inline TokenCategory categoryOf(Tokens t) {
 	return (TokenCategory)((uint16_t)t >> 12);
 }
-/**@return the precedence of the token. Higher values represent higher precedence (go first)*/
+/**
+* @return the precedence of a binary operator. Higher values represent higher precedence (go first)
+* Follows C. 0 for tokens that are not binary operators
+*/
 constexpr inline int precedence(Tokens t) {
 	switch (t) {
 	case Tokens::op_exp:
-		return 10;
+		return 13;
 	case Tokens::op_div:
 	case Tokens::op_mul:
 	case Tokens::op_mod:
-		return 9;
+		return 12;
 	case Tokens::op_minus:
 	case Tokens::op_plus:
-		return 8;
-	case Tokens::op_and:
-	case Tokens::op_bit_and:
-	case Tokens::op_bit_or:
-	case Tokens::op_xor:
+		return 11;
 	case Tokens::op_sh_left:
 	case Tokens::op_sh_right:
-		return 7;
-	case Tokens::op_or:
-		return 6;
+		return 10;
 	case Tokens::op_gr:
 	case Tokens::op_gre:
-	case Tokens::op_test:
 	case Tokens::op_le:
 	case Tokens::op_lee:
+		return 9;
+	case Tokens::op_test:
+	case Tokens::op_ne:
+		return 8;
+	case Tokens::op_bit_and:
+		return 7;
+	case Tokens::op_xor:
+		return 6;
+	case Tokens::op_bit_or:
 		return 5;
+	case Tokens::op_and:
+		return 4;
+	case Tokens::op_bool_xor:
+		return 3;
+	case Tokens::op_or:
+		return 2;
+	case Tokens::op_eq:
+		return 1;
 	default: //functions
 		return 0;
 	}
 }
-using TokenData = std::variant<std::string, double, float, long long, long, short>;
+/**@return true if a chain of the operator groups from the right. a = b = c is a = (b = c)*/
+constexpr inline bool rightAssociative(Tokens t) {
+	return t == Tokens::op_eq || t == Tokens::op_exp;
+}
+//Enough characters for the shortest round trip representation of any numeric literal
+constexpr size_t max_number_length = 32;
+/**
+* Formats a number with std::to_chars. Floating point values use the shortest representation that round trips
+* Requires that [first, last) holds at least max_number_length characters
+* @return pointer one past the last character written
+*/
+template<typename T>
+inline char* formatNumber(char* first, char* last, T value) {
+	return std::to_chars(first, last, value).ptr;
+}
+template<typename T>
+inline std::string numberString(T value) {
+	char buf[max_number_length];
+	return std::string(buf, formatNumber(buf, buf + max_number_length, value));
+}
 //Represents a language token
 class Token {
 private:
@@ -122,23 +158,21 @@ public:
 	inline Tokens getType() const { return type; }
 	inline TokenCategory getCategory() const { return categoryOf(type); }
 	inline void setType(Tokens t) { type = t; }
-	inline const std::string& getStr() const { return std::get<std::string>(data); }
-	inline const double& getDbl() const { return std::get<double>(data); }
-	inline const float getFlt() const { return std::get<float>(data); }
-	inline const long long& getLng() const { return std::get<long long>(data); }
-	inline long getInt() const { return std::get<long>(data); }
-	inline short getShort() const { return std::get<short>(data); }
-	inline void setVar(const TokenData&& d) { data = d; }
-	inline TokenData getData() const { return data; }
+	inline std::string_view getStr() const { return data.get<std::string_view>(); }
+	inline double getDbl() const { return data.get<double>(); }
+	inline float getFlt() const { return data.get<float>(); }
+	inline long long getLng() const { return data.get<long long>(); }
+	inline long getInt() const { return data.get<long>(); }
+	inline short getShort() const { return data.get<short>(); }
+	inline Symbol getSymbol() const { return data.get<Symbol>(); }
+	inline uint32_t getSite() const { return data.site(); } //requires a variable
+	inline void setVar(TokenData&& d) { data = std::move(d); }
+	inline const TokenData& getData() const { return data; }
 	inline void setData(const double& t)
 	{
 		data = t;
 	}
-	inline void setData(const std::string& t)
-	{
-		data = t;
-	}
-	inline void setData(const std::string&& t)
+	inline void setData(std::string_view t)
 	{
 		data = t;
 	}
@@ -162,9 +196,21 @@ public:
 	{
 		data = (long)t;
 	}
+	inline void setData(const Symbol t)
+	{
+		data = t;
+	}
+	/**Sets a variable name with the inline cache site of the reference*/
+	inline void setData(const Symbol t, uint32_t site)
+	{
+		data = TokenData(t, site);
+	}
 	//Gets string representation of token.
 	//Returns emptry string if token is not a literal
 	std::string literalValue() const;
+	//Writes the string representation of the token to out
+	//Numbers are formatted straight into the stream without a temporary string. Writes nothing if token is not a literal
+	void print(FILE* out) const;
 	bool operator==(const Token& other) const;
 
 };
\ No newline at end of file
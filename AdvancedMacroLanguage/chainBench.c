@@ -0,0 +1,13 @@
+Parser benchmark: chains of 5000 terms and 900 nested parentheses, each parsed in one linear pass, then a chain that reads a variable evaluated 1000 times
+##print 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * 1 + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + 1 * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * 1 - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - 1 * 2 + 3 * 4 - 5, "\n";
+##print 20000 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3 - 3, "\n";
+##print ((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((1 + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1) + 1), "\n";
+##decl x = 1;
+##decl chain = { return (x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5 * 6 + 7 * 8 - 9 * x + 2 * 3 - 4 * 5 + 6 * 7 - 8 * 9 + x * 2 - 3 * 4 + 5 * 6 - 7 * 8 + 9 * x - 2 * 3 + 4 * 5 - 6 * 7 + 8 * 9 - x * 2 + 3 * 4 - 5); };
+##decl i = 0;
+##decl j = 0;
+##decl sum = 0;
+##decl inner = { j = j + 1; sum = sum + (exec chain); if j < 25, { exec inner; }; };
+##decl outer = { i = i + 1; j = 0; exec inner; if i < 40, { exec outer; }; };
+##exec outer;
+##print sum, "\n";
@@ -0,0 +1,17 @@
+Parser benchmark: chains of 5000 terms and 900 nested parentheses, each parsed in one linear pass, then a chain that reads a variable evaluated 1000 times
+-21
+
+5003
+
+901
+
+
+
+
+
+
+
+
+
+-21000
+
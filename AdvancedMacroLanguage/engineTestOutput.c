@@ -0,0 +1,63 @@
+//Runs with the default engine and with engine:closure must both give engineTestOutput.c and print the errors in engineTestErrors.txt
+//Precedence and grouping
+14 20 512 3 3 4
+
+1 0 1 3 1 0
+
+3.5 3 3.5 abcd n5 1
+
+
+0 1.5 -1.5 2 0 0.25
+
+//The least long long: % -1 is 0, / -1 overflows
+
+-9223372036854775808 0 0 0 -7
+
+//Short-circuit: the right operands would fail if they ran
+
+
+0 1 0 1 0
+
+1 1 2
+
+
+if ran
+
+//exec and arguments
+
+
+
+5 0 3 111
+
+
+
+102 42
+
+//Recursion
+
+
+3628800 610
+
+//Bounds of random of any number type
+1 1 7
+
+//Code blocks run inside operations, nested deeper than the first operand stack holds
+
+
+121 0
+
+//A chain deeper than the closure engine nests
+1500
+
+//Errors
+
+
+
+
+
+
+
+
+
+after errors
+
@@ -0,0 +1,26 @@
+//Inlining of blocks at exec calls. Run with inline:on and inline:off on both engines: each gives inlineTestOutput.c and the errors in inlineTestErrors.txt
+##decl a = 4;
+##print (exec { return (args_0 + args_1); }, 3, 5), "\n";
+##print (exec { return (args_0 * args_0 + args_length); }, a), "\n";
+##print (exec { return (args_0 + args_1); }, (a * 2), a), "\n";
+##print (exec { return (args_0 * args_0); }, (a + 1)), "\n";
+##decl f = { decl r = 0; r = exec { return (args_0 + args_1 + args_2); }, 1, 2; return (r); };
+##print (exec f, 10, 20, 30), "\n";
+##print (exec f), "\n";
+##decl g = { return (exec { return (args_0 - x); }, args_0); };
+##decl x = 100;
+##print (exec g, 1), "\n";
+##print (exec { return (args_0); }, 9), "\n";
+##print (exec { return ("s" + args_0); }, 7), "\n";
+##print (exec { return (args_0 / args_1); }, 1, 0), "\n";
+##print (exec { return (q + 1); }), "\n";
+##print (exec { return (args_0 && args_1); }, 0, a), "\n";
+##print (exec { return (args_0 + args_1); }, (exec { return (args_0 * 2); }, 3), 1), "\n";
+##print "end\n";
+##print (exec { return (args_0 && args_1); }, 0, (nope + 1)), "\n";
+##print (exec { return (args_0 || args_1); }, 1, (1 / 0)), "\n";
+##print (exec { return (args_1 - args_0); }, (nope + 1), (1 / 0)), "\n";
+##print (exec { return (q + args_0); }, (1 / 0)), "\n";
+##print (exec { return ((q * 2) + args_0); }, (1 / 0)), "\n";
+##print (exec { return (args_0 + args_1); }, (a * 2), (a / 2)), "\n";
+##print "done\n";
@@ -0,0 +1,39 @@
+//Inlining of blocks at exec calls. Run with inline:on and inline:off on both engines: each gives inlineTestOutput.c and the errors in inlineTestErrors.txt
+
+8
+
+17
+
+12
+
+25
+
+
+33
+
+
+
+
+-99
+
+9
+
+s7
+
+
+
+0
+
+7
+
+end
+
+
+
+
+
+
+10
+
+done
+
@@ -0,0 +1,27 @@
+Evaluation benchmark: a block of int, double and string statements run 100000 times from three nested recursive loops, then recursive fib 24
+##decl body = {
+    decl a = args_0;
+    decl b = 2.5;
+    decl s = "x";
+    decl t = 0;
+    a = a + 3 * 3 - a / 7;
+    b = b * 1.01 + a;
+    s = s + "y";
+    t = (a > 5) + (b < 3.5) + t;
+    a = a - a / 3 + 1;
+    b = b / 1.5 - a;
+    s = s + a;
+    t = t + (a >= b) + (b < a);
+    return (b + t);
+};
+##decl i = 0;
+##decl j = 0;
+##decl k = 0;
+##decl total = 0;
+##decl inner = { k = k + 1; total = total + (exec body, j + k); if k < 50, { exec inner; }; };
+##decl middle = { j = j + 1; k = 0; exec inner; if j < 50, { exec middle; }; };
+##decl outer = { i = i + 1; j = 0; exec middle; if i < 40, { exec outer; }; };
+##exec outer;
+##print i * j * k, " runs, total ", total, "\n";
+##decl fib = { decl r = args_0; if (args_0 > 1), { r = (exec fib, (args_0 - 1)) + (exec fib, (args_0 - 2)); }; return (r); };
+##print "fib 24 = ", (exec fib, 24), "\n";
@@ -0,0 +1,15 @@
+Evaluation benchmark: a block of int, double and string statements run 100000 times from three nested recursive loops, then recursive fib 24
+
+
+
+
+
+
+
+
+
+100000 runs, total 339746.6666664652
+
+
+fib 24 = 46368
+
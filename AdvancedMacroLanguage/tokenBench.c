@@ -0,0 +1,356 @@
+Tokenizer benchmark: identifiers, numbers, whitespace runs and string literals from 1 to 120 characters long, so runs end both in the vector scanners and in their scalar tails, then a block of them run 100 times
+##decl  count0	 	 	 	=               000000000000L                ;
+##decl	 	 	 	count1_abcdefghijklmnopqrstuvwxyz_ABCD               =                00000000000000000000007919L	 	 	 	 	 	 	 	 	;
+##decl               count2_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abc                =	 	 	 	 	 	 	 	 	00000000000000000000000000000000015838L                               ;
+##decl                count3_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM	 	 	 	 	 	 	 	 	=                               0000000000000000000000000000000000000000000023757L                                ;
+##decl	 	 	 	 	 	 	 	 	count4_abcdefghijklmnopqrstuv                               =                                000000000000000000000000000000000000000000000000000000031676L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+##decl                               count5_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234                                =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	00000000000000000000000000000000000000000000000000000000000000000039595L                                               ;
+##decl                                count6_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCD	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                               0000000000000000000000000000000000000000000000000000000000000000000000000000047514L                                                                ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count7_abcdefghijklm                                               =                                                                000000000000000000000000000000000000000000000000000000000000000000000000000000000000000055433L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+##decl                                               count8_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVW                                                                =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000063352L                                                                                                    ;
+##decl                                                                count9_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuv	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                                                                                    0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000071271L ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count10_abc                                                                                                    = 000000079190L	 ;
+##decl                                                                                                    count11_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM =	 00000000000000000087109L       ;
+##decl count12_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijkl	 =       0000000000000000000000000000095028L               ;
+##decl	 count13       =               0000000000000000000000000000000000000000102947L	 	 	 	 	 	 	 	 ;
+##decl       count14_abcdefghijklmnopqrstuvwxyz_ABCD               =	 	 	 	 	 	 	 	 000000000000000000000000000000000000000000000000000110866L                 ;
+##decl               count15_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abc	 	 	 	 	 	 	 	 =                 00000000000000000000000000000000000000000000000000000000000000118785L                               ;
+##decl	 	 	 	 	 	 	 	 count16_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM                 =                               0000000000000000000000000000000000000000000000000000000000000000000000000126704L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+##decl                 count17_abcdefghijklmnopqrstuv                               =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 000000000000000000000000000000000000000000000000000000000000000000000000000000000000134623L                                 ;
+##decl                               count18_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 =                                 00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000142542L                                               ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count19_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCD                                 =                                               0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000150461L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+##decl                                 count20_abcdefghijklm                                               =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 000158380L                                                                 ;
+##decl                                               count21_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVW	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 =                                                                 00000000000000166299L                                                                                                    ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count22_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuv                                                                 =                                                                                                    0000000000000000000000000174218L	;
+##decl                                                                 count23_abcd                                                                                                    =	000000000000000000000000000000000000182137L  ;
+##decl                                                                                                    count24_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMN	=  00000000000000000000000000000000000000000000000190056L       ;
+##decl	count25_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm  =       0000000000000000000000000000000000000000000000000000000000197975L	 	 	 	 	 	 	 	;
+##decl  count26       =	 	 	 	 	 	 	 	000000000000000000000000000000000000000000000000000000000000000000000205894L                ;
+##decl       count27_abcdefghijklmnopqrstuvwxyz_ABCDE	 	 	 	 	 	 	 	=                00000000000000000000000000000000000000000000000000000000000000000000000000000000213813L                 ;
+##decl	 	 	 	 	 	 	 	count28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcd                =                 0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000221732L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+##decl                count29_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMN                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000229651L                                ;
+##decl                 count30_abcdefghijklmnopqrstuvw	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000237570L                                 ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count31_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012345                                =                                 0000000000245489L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+##decl                                count32_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDE                                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	000000000000000000000253408L                                                                ;
+##decl                                 count33_abcdefghijklmn	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                                                00000000000000000000000000000000261327L                                                                 ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count34_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWX                                                                =                                                                 0000000000000000000000000000000000000000000269246L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+##decl                                                                count35_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvw                                                                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 000000000000000000000000000000000000000000000000000000277165L ;
+##decl                                                                 count36_abcde	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 = 00000000000000000000000000000000000000000000000000000000000000000285084L  ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count37_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNO =  0000000000000000000000000000000000000000000000000000000000000000000000000000293003L	 	 	 	;
+##decl count38_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmn  =	 	 	 	000000000000000000000000000000000000000000000000000000000000000000000000000000000000000300922L               ;
+##decl  count39	 	 	 	=               00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000308841L                ;
+##decl	 	 	 	count40_abcdefghijklmnopqrstuvwxyz_ABCDEF               =                0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000316760L	 	 	 	 	 	 	 	 	;
+##decl               count41_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcde                =	 	 	 	 	 	 	 	 	000000324679L                               ;
+##decl                count42_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNO	 	 	 	 	 	 	 	 	=                               00000000000000000332598L                                ;
+##decl	 	 	 	 	 	 	 	 	count43_abcdefghijklmnopqrstuvwx                               =                                0000000000000000000000000000340517L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+##decl                               count44_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456                                =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	000000000000000000000000000000000000000348436L                                               ;
+##decl                                count45_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEF	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                               00000000000000000000000000000000000000000000000000356355L                                                                ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count46_abcdefghijklmno                                               =                                                                0000000000000000000000000000000000000000000000000000000000000364274L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+##decl                                               count47_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXY                                                                =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	000000000000000000000000000000000000000000000000000000000000000000000000372193L                                                                                                    ;
+##decl                                                                count48_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwx	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                                                                                    00000000000000000000000000000000000000000000000000000000000000000000000000000000000380112L ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count49_abcdef                                                                                                    = 0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000388031L	 ;
+##decl                                                                                                    count50_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOP =	 000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000395950L       ;
+##decl count51_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmno	 =       00403869L               ;
+##decl	 count52       =               0000000000000411788L	 	 	 	 	 	 	 	 ;
+##decl       count53_abcdefghijklmnopqrstuvwxyz_ABCDEFG               =	 	 	 	 	 	 	 	 000000000000000000000000419707L                 ;
+##decl               count54_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdef	 	 	 	 	 	 	 	 =                 00000000000000000000000000000000000427626L                               ;
+##decl	 	 	 	 	 	 	 	 count55_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOP                 =                               0000000000000000000000000000000000000000000000435545L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+##decl                 count56_abcdefghijklmnopqrstuvwxy                               =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 000000000000000000000000000000000000000000000000000000000443464L                                 ;
+##decl                               count57_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234567	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 =                                 00000000000000000000000000000000000000000000000000000000000000000000451383L                                               ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count58_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFG                                 =                                               0000000000000000000000000000000000000000000000000000000000000000000000000000000459302L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+##decl                                 count59_abcdefghijklmnop                                               =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000467221L                                                                 ;
+##decl                                               count60_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 =                                                                 00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000475140L                                                                                                    ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count61_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxy                                                                 =                                                                                                    0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000483059L	;
+##decl                                                                 count62_abcdefg                                                                                                    =	000000000490978L  ;
+##decl                                                                                                    count63_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQ	=  00000000000000000000498897L       ;
+##decl	count64_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnop  =       0000000000000000000000000000000506816L	 	 	 	 	 	 	 	;
+##decl  count65       =	 	 	 	 	 	 	 	000000000000000000000000000000000000000000514735L                ;
+##decl       count66_abcdefghijklmnopqrstuvwxyz_ABCDEFGH	 	 	 	 	 	 	 	=                00000000000000000000000000000000000000000000000000000522654L                 ;
+##decl	 	 	 	 	 	 	 	count67_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefg                =                 0000000000000000000000000000000000000000000000000000000000000000530573L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+##decl                count68_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQ                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	000000000000000000000000000000000000000000000000000000000000000000000000000538492L                                ;
+##decl                 count69_abcdefghijklmnopqrstuvwxyz	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                00000000000000000000000000000000000000000000000000000000000000000000000000000000000000546411L                                 ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count70_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012345678                                =                                 0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000554330L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+##decl                                count71_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGH                                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000562249L                                                                ;
+##decl                                 count72_abcdefghijklmnopq	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                                                00000570168L                                                                 ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count73_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_                                                                =                                                                 0000000000000000578087L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+##decl                                                                count74_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz                                                                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 000000000000000000000000000586006L ;
+##decl                                                                 count75_abcdefgh	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 = 00000000000000000000000000000000000000593925L  ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count76_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQR =  0000000000000000000000000000000000000000000000000601844L	 	 	 	;
+##decl count77_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq  =	 	 	 	000000000000000000000000000000000000000000000000000000000000609763L               ;
+##decl  count78	 	 	 	=               00000000000000000000000000000000000000000000000000000000000000000000000617682L                ;
+##decl	 	 	 	count79_abcdefghijklmnopqrstuvwxyz_ABCDEFGHI               =                0000000000000000000000000000000000000000000000000000000000000000000000000000000000625601L	 	 	 	 	 	 	 	 	;
+##decl               count80_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefgh                =	 	 	 	 	 	 	 	 	000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000633520L                               ;
+##decl                count81_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQR	 	 	 	 	 	 	 	 	=                               00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000641439L                                ;
+##decl	 	 	 	 	 	 	 	 	count82_abcdefghijklmnopqrstuvwxyz_                               =                                0649358L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+##decl                               count83_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789                                =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	000000000000657277L                                               ;
+##decl                                count84_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHI	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                               00000000000000000000000665196L                                                                ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count85_abcdefghijklmnopqr                                               =                                                                0000000000000000000000000000000000673115L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+##decl                                               count86_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0                                                                =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	000000000000000000000000000000000000000000000681034L                                                                                                    ;
+##decl                                                                count87_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                                                                                    00000000000000000000000000000000000000000000000000000000688953L ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count88_abcdefghi                                                                                                    = 0000000000000000000000000000000000000000000000000000000000000000000696872L	 ;
+##decl                                                                                                    count89_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS =	 000000000000000000000000000000000000000000000000000000000000000000000000000000704791L       ;
+##decl count90_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqr	 =       00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000712710L               ;
+##decl	 count91_       =               0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000720629L	 	 	 	 	 	 	 	 ;
+##decl       count92_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ               =	 	 	 	 	 	 	 	 000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000728548L                 ;
+##decl               count93_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghi	 	 	 	 	 	 	 	 =                 00000000736467L                               ;
+##decl	 	 	 	 	 	 	 	 count94_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS                 =                               0000000000000000000744386L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+##decl                 count95_abcdefghijklmnopqrstuvwxyz_A                               =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 000000000000000000000000000000752305L                                 ;
+##decl                               count96_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 =                                 00000000000000000000000000000000000000000760224L                                               ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count97_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ                                 =                                               0000000000000000000000000000000000000000000000000000768143L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+##decl                                 count98_abcdefghijklmnopqrs                                               =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 000000000000000000000000000000000000000000000000000000000000000776062L                                                                 ;
+##decl                                               count99_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 =                                                                 00000000000000000000000000000000000000000000000000000000000000000000000000783981L                                                                                                    ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count100_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_                                                                 =                                                                                                    0000000000000000000000000000000000000000000000000000000000000000000000000000000000000791900L	;
+##decl                                                                 count101_abcdefghi                                                                                                    =	000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000799819L  ;
+##decl                                                                                                    count102_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS	=  00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000807738L       ;
+##decl	count103_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqr  =       0000815657L	 	 	 	 	 	 	 	;
+##decl  count104_       =	 	 	 	 	 	 	 	000000000000000823576L                ;
+##decl       count105_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ	 	 	 	 	 	 	 	=                00000000000000000000000000831495L                 ;
+##decl	 	 	 	 	 	 	 	count106_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghi                =                 0000000000000000000000000000000000000839414L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+##decl                count107_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	000000000000000000000000000000000000000000000000847333L                                ;
+##decl                 count108_abcdefghijklmnopqrstuvwxyz_A	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                00000000000000000000000000000000000000000000000000000000000855252L                                 ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count109_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_                                =                                 0000000000000000000000000000000000000000000000000000000000000000000000863171L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+##decl                                count110_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ                                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	000000000000000000000000000000000000000000000000000000000000000000000000000000000871090L                                                                ;
+##decl                                 count111_abcdefghijklmnopqrs	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                                                00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000879009L                                                                 ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count112_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01                                                                =                                                                 0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000886928L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+##decl                                                                count113_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_A                                                                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 894847L ;
+##decl                                                                 count114_abcdefghij	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 = 00000000000902766L  ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count115_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRST =  0000000000000000000000910685L	 	 	 	;
+##decl count116_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrs  =	 	 	 	000000000000000000000000000000000918604L               ;
+##decl  count117_a	 	 	 	=               00000000000000000000000000000000000000000000926523L                ;
+##decl	 	 	 	count118_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJK               =                0000000000000000000000000000000000000000000000000000000934442L	 	 	 	 	 	 	 	 	;
+##decl               count119_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghij                =	 	 	 	 	 	 	 	 	000000000000000000000000000000000000000000000000000000000000000000942361L                               ;
+##decl                ratio0	 	 	 	 	 	 	 	 	=                               000000000000000000000000000000000000000000000000000000000000000000000000000000.0                                ;
+##decl	 	 	 	 	 	 	 	 	ratio1_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRST                               =                                00000000000000000000000000000000000000000000000000000000000000000000000000000000000000001.123456789012345678	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+##decl                               ratio2_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGH                                =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002.23456789012345678901234567890123456                                               ;
+##decl                                ratio3_abcdefghijklmnopqrstuvwxyz_ABCDEF	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                               000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003.3456789012345678901234567890123456789012345678901234                                                                ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	ratio4_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstu                                               =                                                                00000004.456789012345678901234567890123456789012345678901234567890123456789012	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+##decl                                               ratio5_abcdefghijklmnopqrs                                                                =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	0000000000000000005.56789012345678901234567890123456789012345678901234567890123456789012345678901234567890                                                                                                    ;
+##decl                                                                ratio6_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefg	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                                                                                    000000000000000000000000000006.6789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678 ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	ratio7_abcde                                                                                                    = 00000000000000000000000000000000000000000.7890123456	 ;
+##decl                                                                                                    ratio8_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123 =	 0000000000000000000000000000000000000000000000000001.890123456789012345678901234       ;
+##decl ratio9_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS	 =       000000000000000000000000000000000000000000000000000000000000002.90123456789012345678901234567890123456789012               ;
+##decl	 ratio10_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOP       =               00000000000000000000000000000000000000000000000000000000000000000000000003.0123456789012345678901234567890123456789012345678901234567890	 	 	 	 	 	 	 	 ;
+##decl       ratio11_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCD               =	 	 	 	 	 	 	 	 0000000000000000000000000000000000000000000000000000000000000000000000000000000000004.123456789012345678901234567890123456789012345678901234567890123456789012345678                 ;
+##decl               ratio12_abcdefghijklmnopqrstuvwxyz_AB	 	 	 	 	 	 	 	 =                 000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000005.23456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456                               ;
+##decl	 	 	 	 	 	 	 	 ratio13_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq                 =                               00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000006.34	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+##decl                 ratio14_abcdefghijklmno                               =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 0000.4567890123456789012                                 ;
+##decl                               ratio15_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abc	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 =                                 000000000000001.567890123456789012345678901234567890                                               ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ratio16_a                                 =                                               00000000000000000000000002.67890123456789012345678901234567890123456789012345678	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+##decl                                 ratio17_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_                                               =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 0000000000000000000000000000000000003.7890123456789012345678901234567890123456789012345678901234567890123456                                                                 ;
+##decl                                               ratio18_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNO	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 =                                                                 000000000000000000000000000000000000000000000004.890123456789012345678901234567890123456789012345678901234567890123456789012345678901234                                                                                                    ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ratio19_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM                                                                 =                                                                                                    00000000000000000000000000000000000000000000000000000000005.90123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012	;
+##decl                                                                 ratio20_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_A                                                                                                    =	0000000000000000000000000000000000000000000000000000000000000000000006.01234567890  ;
+##decl                                                                                                    ratio21_abcdefghijklmnopqrstuvwxyz	=  000000000000000000000000000000000000000000000000000000000000000000000000000000000.1234567890123456789012345678       ;
+##decl	ratio22_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmn  =       00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001.234567890123456789012345678901234567890123456	 	 	 	 	 	 	 	;
+##decl  ratio23_abcdefghijkl       =	 	 	 	 	 	 	 	0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002.34567890123456789012345678901234567890123456789012345678901234                ;
+##decl       ratio24_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_	 	 	 	 	 	 	 	=                000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003.4567890123456789012345678901234567890123456789012345678901234567890123456789012                 ;
+##decl	 	 	 	 	 	 	 	ratio25                =                 00000000004.567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+##decl                ratio26_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWX                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	0000000000000000000005.678                                ;
+##decl                 ratio27_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKL	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                000000000000000000000000000000006.78901234567890123456                                 ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	ratio28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ                                =                                 00000000000000000000000000000000000000000000.8901234567890123456789012345678901234	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+##decl                                ratio29_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxy                                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	0000000000000000000000000000000000000000000000000000001.901234567890123456789012345678901234567890123456789012                                                                ;
+##decl                                 text0	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                                                ""                                                                 ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	text1_abcdefghijklmnopqrstuvwx                                                                =                                                                 "bcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNO"	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+##decl                                                                text2_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ                                                                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 "cdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrs" ;
+##decl                                                                 text3_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 = "def"  ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 text4_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS =  "efghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTU"	 	 	 	;
+##decl text5_abcdefghijklmnopqrst  =	 	 	 	"fghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxy"               ;
+##decl  text6_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUV	 	 	 	=               "ghijkl"                ;
+##decl	 	 	 	text7_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm               =                "hi\tjklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXY\"_"	 	 	 	 	 	 	 	 	;
+##decl               text8_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNO                =	 	 	 	 	 	 	 	 	"ijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCD"                               ;
+##decl                text9_abcdefghijklmnop	 	 	 	 	 	 	 	 	=                               "jklmnopqr"                                ;
+##decl	 	 	 	 	 	 	 	 	text10_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQ                               =                                "klmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012345"	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+##decl                               text11_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefgh                                =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	"lmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_a\tbcdefghijklmnopqrstuvwxyz_ABCDEFGH\"J"                                               ;
+##decl                                text12_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                               "mnopqrstuvwx"                                                                ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	text13_abcdefghijk                                               =                                                                "nopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_a"	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+##decl                                               text14_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM                                                                =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	"opqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOP"                                                                                                    ;
+##decl                                                                text15_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcd	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                                                                                    "p\tqrstuvwxyz_A\"C" ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	text16_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEF                                                                                                    = "qrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefg"	 ;
+##decl                                                                                                    text17_abcdefg =	 "rstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUV"       ;
+##decl text18_abcdefghijklmnopqrstuvwxyz_ABCDEFGHI	 =       "stuvwxyz_ABCDEFGHI"               ;
+##decl	 text19_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_       =               "tuvwxyz_ABCDEFGHIJKL\tMNOPQRSTUVWXYZ_0123456789_abcdefghijk\"m"	 	 	 	 	 	 	 	 ;
+##decl       text20_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_AB               =	 	 	 	 	 	 	 	 "uvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0"                 ;
+##decl               text21_abc	 	 	 	 	 	 	 	 =                 "vwxyz_ABCDEFGHIJKLMNO"                               ;
+##decl	 	 	 	 	 	 	 	 text22_abcdefghijklmnopqrstuvwxyz_ABCDE                 =                               "wxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrs"	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+##decl                 text23_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456                               =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 "xyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01\t234\"6"                                 ;
+##decl                               text24_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxy	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 =                                 "yz_ABCDEFGHIJKLMNOPQRSTU"                                               ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 text25                                 =                                               "z_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxy"	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+##decl                                 text26_abcdefghijklmnopqrstuvwxyz_A                                               =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 "_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_ab"                                                                 ;
+##decl                                               text27_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 =                                                                 "AB\tCDEFGHIJKLMNOPQRSTUVWXY\"_"                                                                                                    ;
+##decl	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 text28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstu                                                                 =                                                                                                    "BCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCD"	;
+##decl                                                                 text29                                                                                                    =	"CDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefgh"  ;
+##decl round = 0;
+##decl matches = 0;
+##decl work = {
+                count0                                                                                                    =	(count0  +       count3_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM                                                                                                    *	0L  -       count5_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234)                                                                                                    %	1000003  ;
+                 count1_abcdefghijklmnopqrstuvwxyz_ABCD	=  (count1_abcdefghijklmnopqrstuvwxyz_ABCD       +	 	 	 	 	 	 	 	count10_abc	*  00000000000104729L       -	 	 	 	 	 	 	 	count18_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234)	%  1000003       ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	matches  =       matches	 	 	 	 	 	 	 	+                (text2_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ  ==       text12_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ)	 	 	 	 	 	 	 	+                ("cdefghijklmnopqrstuvwx"  ==       text2_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ)	 	 	 	 	 	 	 	;
+                                count3_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM       =	 	 	 	 	 	 	 	(count3_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM                +                 count24_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMN       *	 	 	 	 	 	 	 	000000000000000000000000000000000314187L                -                 count44_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456)       %	 	 	 	 	 	 	 	1000003                ;
+                                 ratio4_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstu	 	 	 	 	 	 	 	=                ratio4_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstu                 /	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	1.00000000000000000000000000001	 	 	 	 	 	 	 	+                (ratio13_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq                 >	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	3.9999999999999)	 	 	 	 	 	 	 	;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count5_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234                =                 (count5_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                count38_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmn                *                 0000000000000000000000000000000000000000000000000000000523645L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	-                                count70_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012345678)                %                 1000003	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+                                                                count6_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCD                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	(count6_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCD                                +                                 count45_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEF                 *	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	000000000000000000000000000000000000000000000000000000000000000000628374L                                -                                 count83_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789)                 %	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	1000003                                ;
+                                                                 matches	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                matches                                 +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	(text7_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	==                                text7_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm)                                 +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	("hijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrs"	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	==                                text7_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm)                                 ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count8_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVW                                =                                 (count8_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVW	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                                                count59_abcdefghijklmnop                                *                                 0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000837832L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	-                                                                count109_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_)                                %                                 1000003	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+ ratio9_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS                                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	ratio9_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS                                                                /                                                                 1.0000000000000000000000000000000000000000000000000000000000000001                                 +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	(ratio28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ                                                                >                                                                 3.9999999999999999999999999999)                                 ;
+  count10_abc	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                                                (count10_abc                                                                 +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count73_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	*                                                                000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001047290L                                                                 -	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count15_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abc)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	%                                                                1000003                                                                 ;
+	 	 	 	count11_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM                                                                =                                                                 (count11_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 + count80_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefgh                                                                *                                                                 00000001152019L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 - count28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcd)                                                                %                                                                 1000003	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+               matches                                                                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 matches +  (text12_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ                                                                 ==	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 text2_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ) +  ("mnopqrs\ttuv\"x"                                                                 ==	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 text12_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ) ;
+                count13	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 = (count13  +	 	 	 	count94_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 * 000000000000000000000000000001361477L  -	 	 	 	count54_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdef)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 % 1000003  ;
+	 	 	 	 	 	 	 	 	ratio14_abcdefghijklmno =  ratio14_abcdefghijklmno	 	 	 	/               1.000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001 +  (ratio13_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq	 	 	 	>               3.9999999999999999999999999999999999999999999) ;
+                               count15_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abc  =	 	 	 	(count15_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abc               +                count108_abcdefghijklmnopqrstuvwxyz_A  *	 	 	 	0000000000000000000000000000000000000000000000000001570935L               -                count80_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefgh)  %	 	 	 	1000003               ;
+                                count16_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM	 	 	 	=               (count16_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM                +	 	 	 	 	 	 	 	 	count115_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRST	 	 	 	*               000000000000000000000000000000000000000000000000000000000000001675664L                -	 	 	 	 	 	 	 	 	count93_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghi)	 	 	 	%               1000003                ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	matches               =                matches	 	 	 	 	 	 	 	 	+                               (text17_abcdefg               ==                text27_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012)	 	 	 	 	 	 	 	 	+                               ("rstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrs"               ==                text17_abcdefg)	 	 	 	 	 	 	 	 	;
+                                               count18_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234                =	 	 	 	 	 	 	 	 	(count18_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234                               +                                count9_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuv                *	 	 	 	 	 	 	 	 	0000000000000000000000000000000000000000000000000000000000000000000000000000000000001885122L                               -                                count119_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghij)                %	 	 	 	 	 	 	 	 	1000003                               ;
+                                                                ratio19_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM	 	 	 	 	 	 	 	 	=                               ratio19_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM                                /	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	1.0000000000000000000000000000000001	 	 	 	 	 	 	 	 	+                               (ratio28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ                                >	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	3.9999999999999999999999999999999999999999999999999999999999)	 	 	 	 	 	 	 	 	;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count20_abcdefghijklm                               =                                (count20_abcdefghijklm	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                               count23_abcd                               *                                00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002094580L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	-                                               count25_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm)                               %                                1000003	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+                                                                                                    count21_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVW                                =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	(count21_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVW                                               +                                                                count30_abcdefghijklmnopqrstuvw                                *	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	0002199309L                                               -                                                                count38_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmn)                                %	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	1000003                                               ;
+ matches	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                               matches                                                                +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	(text22_abcdefghijklmnopqrstuvwxyz_ABCDE	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	==                                               text22_abcdefghijklmnopqrstuvwxyz_ABCDE)                                                                +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	("wx"	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	==                                               text22_abcdefghijklmnopqrstuvwxyz_ABCDE)                                                                ;
+	 count23_abcd                                               =                                                                (count23_abcd	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                                                                                    count44_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456                                               *                                                                00000000000000000000000002408767L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	-                                                                                                    count64_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnop)                                               %                                                                1000003	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+       ratio24_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_                                                                =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	ratio24_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_                                                                                                    / 1.000000000000000000000000000000000000000000000000000000000000000000001                                                                +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	(ratio13_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq                                                                                                    > 3.9999999999999999999999999999999999999999999999999999999999999999999999999)                                                                ;
+               count25_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                                                                                    (count25_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm +	 count58_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFG	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	*                                                                                                    000000000000000000000000000000000000000000000002618225L -	 count90_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqr)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	%                                                                                                    1000003 ;
+	 	 	 	 	 	 	 	 count26                                                                                                    = (count26	 +       count65                                                                                                    * 00000000000000000000000000000000000000000000000000000000002722954L	 -       count103_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqr)                                                                                                    % 1000003	 ;
+                 matches =	 matches       +               (text27_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012 ==	 text17_abcdefg)       +               ("ABCDEFGHIJKLMNOPQRSTUV\tWXYZ_0123456789_abcdefghijklmnopq\"s" ==	 text27_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012)       ;
+                               count28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcd	 =       (count28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcd               +	 	 	 	 	 	 	 	 count79_abcdefghijklmnopqrstuvwxyz_ABCDEFGHI	 *       000000000000000000000000000000000000000000000000000000000000000000000000000000002932412L               -	 	 	 	 	 	 	 	 count9_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuv)	 %       1000003               ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ratio29_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxy       =               ratio29_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxy	 	 	 	 	 	 	 	 /                 1.0001       +               (ratio28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ	 	 	 	 	 	 	 	 >                 3.9999999999999999999999999999999999999999999999999999999999999999999999999999999999999999)       ;
+                                 count30_abcdefghijklmnopqrstuvw               =	 	 	 	 	 	 	 	 (count30_abcdefghijklmnopqrstuvw                 +                               count93_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghi               *	 	 	 	 	 	 	 	 0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003141870L                 -                               count35_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvw)               %	 	 	 	 	 	 	 	 1000003                 ;
+                                               count31_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012345	 	 	 	 	 	 	 	 =                 (count31_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012345                               +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count100_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_	 	 	 	 	 	 	 	 *                 000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003246599L                               -	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count48_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwx)	 	 	 	 	 	 	 	 %                 1000003                               ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 matches                 =                               matches	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 +                                 (text2_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ                 ==                               text12_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 +                                 ("FGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmn"                 ==                               text2_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+                                                                 count33_abcdefghijklmn                               =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 (count33_abcdefghijklmn                                 +                                               count114_abcdefghij                               *	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 0000000000000000000003456057L                                 -                                               count74_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz)                               %	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 1000003                                 ;
+                                                                                                    ratio4_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstu	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 =                                 ratio4_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstu                                               /	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 1.000000000000000000000000000000000000001	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 +                                 (ratio13_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq                                               >	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 3.9999999999999)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+	count35_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvw                                 =                                               (count35_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvw	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 +                                                                 count8_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVW                                 *                                               00000000000000000000000000000000000000000003665515L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 -                                                                 count100_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_)                                 %                                               1000003	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+  count36_abcde                                               =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 (count36_abcde                                                                 +                                                                                                    count15_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abc                                               *	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 0000000000000000000000000000000000000000000000000000003770244L                                                                 -                                                                                                    count113_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_A)                                               %	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 1000003                                                                 ;
+       matches	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 =                                                                 matches                                                                                                    +	(text7_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ==                                                                 text7_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm)                                                                                                    +	("KLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrs"	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ==                                                                 text7_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm)                                                                                                    ;
+	 	 	 	 	 	 	 	count38_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmn                                                                 =                                                                                                    (count38_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmn	+  count29_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMN                                                                 *                                                                                                    00000000000000000000000000000000000000000000000000000000000000000000000000003979702L	-  count19_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCD)                                                                 %                                                                                                    1000003	;
+                ratio9_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS                                                                                                    =	ratio9_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS  /       1.00000000000000000000000000000000000000000000000000000000000000000000000001                                                                                                    +	(ratio28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ  >       3.9999999999999999999999999999)                                                                                                    ;
+                 count40_abcdefghijklmnopqrstuvwxyz_ABCDEF	=  (count40_abcdefghijklmnopqrstuvwxyz_ABCDEF       +	 	 	 	 	 	 	 	count43_abcdefghijklmnopqrstuvwx	*  000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000004189160L       -	 	 	 	 	 	 	 	count45_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEF)	%  1000003       ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count41_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcde  =       (count41_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcde	 	 	 	 	 	 	 	+                count50_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOP  *       00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000004293889L	 	 	 	 	 	 	 	-                count58_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFG)  %       1000003	 	 	 	 	 	 	 	;
+                                matches       =	 	 	 	 	 	 	 	matches                +                 (text12_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ       ==	 	 	 	 	 	 	 	text2_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ)                +                 ("PQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwx\tyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijkl\"n"       ==	 	 	 	 	 	 	 	text12_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ)                ;
+                                 count43_abcdefghijklmnopqrstuvwx	 	 	 	 	 	 	 	=                (count43_abcdefghijklmnopqrstuvwx                 +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count64_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnop	 	 	 	 	 	 	 	*                000000000000000004503347L                 -	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count84_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHI)	 	 	 	 	 	 	 	%                1000003                 ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	ratio14_abcdefghijklmno                =                 ratio14_abcdefghijklmno	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	/                                1.000000001                +                 (ratio13_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	>                                3.9999999999999999999999999999999999999999999)                ;
+                                                                count45_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEF                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	(count45_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEF                                +                                 count78                 *	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	0000000000000000000000000000000000000004712805L                                -                                 count110_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ)                 %	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	1000003                                ;
+                                                                 count46_abcdefghijklmno	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                (count46_abcdefghijklmno                                 +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count85_abcdefghijklmnopqr	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	*                                000000000000000000000000000000000000000000000000004817534L                                 -	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count3_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	%                                1000003                                 ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 matches                                =                                 matches	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                                                (text17_abcdefg                                ==                                 text27_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                                                ("UVWXYZ_0123456789_abcdefghijklmnopqrs"                                ==                                 text17_abcdefg)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+ count48_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwx                                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	(count48_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwx                                                                +                                                                 count99_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01                                 *	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	0000000000000000000000000000000000000000000000000000000000000000000000005026992L                                                                -                                                                 count29_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMN)                                 %	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	1000003                                                                ;
+  ratio19_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                                                ratio19_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM                                                                 /	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 1.00000000000000000000000000000000000000000001	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                                                (ratio28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ                                                                 >	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 3.9999999999999999999999999999999999999999999999999999999999)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+	 	 	 	count50_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOP                                                                =                                                                 (count50_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOP	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 + count113_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_A                                                                *                                                                 00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000005236450L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 - count55_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOP)                                                                %                                                                 1000003	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+               count51_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmno                                                                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 (count51_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmno +  count0                                                                 *	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000005341179L -  count68_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQ)                                                                 %	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 1000003 ;
+                matches	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 = matches  +	 	 	 	(text22_abcdefghijklmnopqrstuvwxyz_ABCDE	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 == text22_abcdefghijklmnopqrstuvwxyz_ABCDE)  +	 	 	 	("Z_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmn"	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 == text22_abcdefghijklmnopqrstuvwxyz_ABCDE)  ;
+	 	 	 	 	 	 	 	 	count53_abcdefghijklmnopqrstuvwxyz_ABCDEFG =  (count53_abcdefghijklmnopqrstuvwxyz_ABCDEFG	 	 	 	+               count14_abcdefghijklmnopqrstuvwxyz_ABCD *  00000000000005550637L	 	 	 	-               count94_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS) %  1000003	 	 	 	;
+                               ratio24_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_  =	 	 	 	ratio24_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_               /                1.0000000000000000000000000000000000000000000000000000000000000000000000000000001  +	 	 	 	(ratio13_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq               >                3.9999999999999999999999999999999999999999999999999999999999999999999999999)  ;
+                                count55_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOP	 	 	 	=               (count55_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOP                +	 	 	 	 	 	 	 	 	count28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcd	 	 	 	*               000000000000000000000000000000000005760095L                -	 	 	 	 	 	 	 	 	count0)	 	 	 	%               1000003                ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count56_abcdefghijklmnopqrstuvwxy               =                (count56_abcdefghijklmnopqrstuvwxy	 	 	 	 	 	 	 	 	+                               count35_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvw               *                00000000000000000000000000000000000000000000005864824L	 	 	 	 	 	 	 	 	-                               count13)               %                1000003	 	 	 	 	 	 	 	 	;
+                                               matches                =	 	 	 	 	 	 	 	 	matches                               +                                (text27_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012                ==	 	 	 	 	 	 	 	 	text17_abcdefg)                               +                                ("3456789_abcdefghi\tjklmnopq\"s"                ==	 	 	 	 	 	 	 	 	text27_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012)                               ;
+                                                                count58_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFG	 	 	 	 	 	 	 	 	=                               (count58_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFG                                +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count49_abcdef	 	 	 	 	 	 	 	 	*                               000000000000000000000000000000000000000000000000000000000000000000006074282L                                -	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count39)	 	 	 	 	 	 	 	 	%                               1000003                                ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	ratio29_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxy                               =                                ratio29_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxy	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	/                                               1.00000000000001                               +                                (ratio28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	>                                               3.9999999999999999999999999999999999999999999999999999999999999999999999999999999999999999)                               ;
+                                                                                                    count60_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ                                =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	(count60_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ                                               +                                                                count63_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQ                                *	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000006283740L                                               -                                                                count65)                                %	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	1000003                                               ;
+ count61_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxy	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                               (count61_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxy                                                                +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count70_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012345678	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	*                                               000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000006388469L                                                                -	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count78)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	%                                               1000003                                                                ;
+	 matches                                               =                                                                matches	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                                                                                    (text2_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ                                               ==                                                                text12_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                                                                                    ("89_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmn"                                               ==                                                                text2_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+       count63_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQ                                                                =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	(count63_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQ                                                                                                    + count84_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHI                                                                *	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	0000000006597927L                                                                                                    - count104_)                                                                %	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	1000003                                                                                                    ;
+               ratio4_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstu	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                                                                                    ratio4_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstu /	 1.0000000000000000000000000000000000000000000000001	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                                                                                    (ratio13_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq >	 3.9999999999999)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+	 	 	 	 	 	 	 	 count65                                                                                                    = (count65	 +       count98_abcdefghijklmnopqrs                                                                                                    * 00000000000000000000000000000006807385L	 -       count10_abc)                                                                                                    % 1000003	 ;
+                 count66_abcdefghijklmnopqrstuvwxyz_ABCDEFGH =	 (count66_abcdefghijklmnopqrstuvwxyz_ABCDEFGH       +               count105_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ *	 0000000000000000000000000000000000000000006912114L       -               count23_abcd) %	 1000003       ;
+                               matches	 =       matches               +	 	 	 	 	 	 	 	 (text7_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm	 ==       text7_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm)               +	 	 	 	 	 	 	 	 ("cdefghijklmnopqrs"	 ==       text7_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm)               ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count68_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQ       =               (count68_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQ	 	 	 	 	 	 	 	 +                 count119_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghij       *               00000000000000000000000000000000000000000000000000000000000000007121572L	 	 	 	 	 	 	 	 -                 count49_abcdef)       %               1000003	 	 	 	 	 	 	 	 ;
+                                 ratio9_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS               =	 	 	 	 	 	 	 	 ratio9_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS                 /                               1.000000000000000000000000000000000000000000000000000000000000000000000000000000000001               +	 	 	 	 	 	 	 	 (ratio28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ                 >                               3.9999999999999999999999999999)               ;
+                                               count70_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012345678	 	 	 	 	 	 	 	 =                 (count70_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012345678                               +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count13	 	 	 	 	 	 	 	 *                 000000000000000000000000000000000000000000000000000000000000000000000000000000000000007331030L                               -	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count75_abcdefgh)	 	 	 	 	 	 	 	 %                 1000003                               ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count71_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGH                 =                               (count71_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGH	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 +                                 count20_abcdefghijklm                 *                               00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000007435759L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 -                                 count88_abcdefghi)                 %                               1000003	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+                                                                 matches                               =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 matches                                 +                                               (text12_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ                               ==	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 text2_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ)                                 +                                               ("hijklmnopqrstuvwxyz_ABCDEFG\tHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijkl\"n"                               ==	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 text12_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ)                                 ;
+                                                                                                    count73_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 =                                 (count73_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_                                               +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count34_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWX	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 *                                 000007645217L                                               -	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count114_abcdefghij)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 %                                 1000003                                               ;
+	ratio14_abcdefghijklmno                                 =                                               ratio14_abcdefghijklmno	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 /                                                                 1.0000000000000000001                                 +                                               (ratio13_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 >                                                                 3.9999999999999999999999999999999999999999999)                                 ;
+  count75_abcdefgh                                               =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 (count75_abcdefgh                                                                 +                                                                                                    count48_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwx                                               *	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 0000000000000000000000000007854675L                                                                 -                                                                                                    count20_abcdefghijklm)                                               %	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 1000003                                                                 ;
+       count76_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQR	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 =                                                                 (count76_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQR                                                                                                    +	count55_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOP	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 *                                                                 000000000000000000000000000000000000007959404L                                                                                                    -	count33_abcdefghijklmn)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 %                                                                 1000003                                                                                                    ;
+	 	 	 	 	 	 	 	matches                                                                 =                                                                                                    matches	+  (text17_abcdefg                                                                 ==                                                                                                    text27_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012)	+  ("mnopqrs"                                                                 ==                                                                                                    text17_abcdefg)	;
+                count78                                                                                                    =	(count78  +       count69_abcdefghijklmnopqrstuvwxyz                                                                                                    *	0000000000000000000000000000000000000000000000000000000000008168862L  -       count59_abcdefghijklmnop)                                                                                                    %	1000003  ;
+                 ratio19_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM	=  ratio19_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM       /	 	 	 	 	 	 	 	1.000000000000000000000000000000000000000000000000000001	+  (ratio28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ       >	 	 	 	 	 	 	 	3.9999999999999999999999999999999999999999999999999999999999)	;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count80_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefgh  =       (count80_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefgh	 	 	 	 	 	 	 	+                count83_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789  *       00000000000000000000000000000000000000000000000000000000000000000000000000000000008378320L	 	 	 	 	 	 	 	-                count85_abcdefghijklmnopqr)  %       1000003	 	 	 	 	 	 	 	;
+                                count81_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQR       =	 	 	 	 	 	 	 	(count81_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQR                +                 count90_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqr       *	 	 	 	 	 	 	 	0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000008483049L                -                 count98_abcdefghijklmnopqrs)       %	 	 	 	 	 	 	 	1000003                ;
+                                 matches	 	 	 	 	 	 	 	=                matches                 +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	(text22_abcdefghijklmnopqrstuvwxyz_ABCDE	 	 	 	 	 	 	 	==                text22_abcdefghijklmnopqrstuvwxyz_ABCDE)                 +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	("rstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmn"	 	 	 	 	 	 	 	==                text22_abcdefghijklmnopqrstuvwxyz_ABCDE)                 ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count83_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789                =                 (count83_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                count104_                *                 08692507L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	-                                count4_abcdefghijklmnopqrstuv)                %                 1000003	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+                                                                ratio24_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	ratio24_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_                                /                                 1.00000000000000000000000000000000000000000000000000000000000000000000000000000000000000001                 +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	(ratio13_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq                                >                                 3.9999999999999999999999999999999999999999999999999999999999999999999999999)                 ;
+                                                                 count85_abcdefghijklmnopqr	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                (count85_abcdefghijklmnopqr                                 +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count118_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJK	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	*                                000000000000000000000008901965L                                 -	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count30_abcdefghijklmnopqrstuvw)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	%                                1000003                                 ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count86_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0                                =                                 (count86_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                                                count5_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234                                *                                 00000000000000000000000000000000009006694L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	-                                                                count43_abcdefghijklmnopqrstuvwx)                                %                                 1000003	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+ matches                                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	matches                                                                +                                                                 (text27_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012                                 ==	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	text17_abcdefg)                                                                +                                                                 ("wxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_\t0123456789_abcdefg\"i"                                 ==	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	text27_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012)                                                                ;
+  count88_abcdefghi	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                                                (count88_abcdefghi                                                                 +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count19_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCD	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	*                                                                000000000000000000000000000000000000000000000000000000009216152L                                                                 -	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count69_abcdefghijklmnopqrstuvwxyz)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	%                                                                1000003                                                                 ;
+	 	 	 	ratio29_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxy                                                                =                                                                 ratio29_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxy	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 / 1.000000000000000000000001                                                                +                                                                 (ratio28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 > 3.9999999999999999999999999999999999999999999999999999999999999999999999999999999999999999)                                                                ;
+               count90_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqr                                                                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 (count90_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqr +  count33_abcdefghijklmn                                                                 *	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 0000000000000000000000000000000000000000000000000000000000000000000000000000009425610L -  count95_abcdefghijklmnopqrstuvwxyz_A)                                                                 %	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 1000003 ;
+                count91_	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 = (count91_  +	 	 	 	count40_abcdefghijklmnopqrstuvwxyz_ABCDEF	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 * 000000000000000000000000000000000000000000000000000000000000000000000000000000000000000009530339L  -	 	 	 	count108_abcdefghijklmnopqrstuvwxyz_A)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 % 1000003  ;
+	 	 	 	 	 	 	 	 	matches =  matches	 	 	 	+               (text2_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ ==  text12_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ)	 	 	 	+               ("ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmn" ==  text2_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ)	 	 	 	;
+                               count93_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghi  =	 	 	 	(count93_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghi               +                count54_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdef  *	 	 	 	0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000009739797L               -                count14_abcdefghijklmnopqrstuvwxyz_ABCD)  %	 	 	 	1000003               ;
+                                ratio4_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstu	 	 	 	=               ratio4_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstu                /	 	 	 	 	 	 	 	 	1.00000000000000000000000000000000000000000000000000000000001	 	 	 	+               (ratio13_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq                >	 	 	 	 	 	 	 	 	3.9999999999999)	 	 	 	;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count95_abcdefghijklmnopqrstuvwxyz_A               =                (count95_abcdefghijklmnopqrstuvwxyz_A	 	 	 	 	 	 	 	 	+                               count68_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQ               *                00000000000000000009949255L	 	 	 	 	 	 	 	 	-                               count40_abcdefghijklmnopqrstuvwxyz_ABCDEF)               %                1000003	 	 	 	 	 	 	 	 	;
+                                               count96_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_                =	 	 	 	 	 	 	 	 	(count96_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_                               +                                count75_abcdefgh                *	 	 	 	 	 	 	 	 	00000000000000000000000000000053993L                               -                                count53_abcdefghijklmnopqrstuvwxyz_ABCDEFG)                %	 	 	 	 	 	 	 	 	1000003                               ;
+                                                                matches	 	 	 	 	 	 	 	 	=                               matches                                +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	(text7_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm	 	 	 	 	 	 	 	 	==                               text7_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm)                                +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	("FGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghi"	 	 	 	 	 	 	 	 	==                               text7_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm)                                ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count98_abcdefghijklmnopqrs                               =                                (count98_abcdefghijklmnopqrs	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                               count89_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS                               *                                0000000000000000000000000000000000000000000000000000263451L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	-                                               count79_abcdefghijklmnopqrstuvwxyz_ABCDEFGHI)                               %                                1000003	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+                                                                                                    ratio9_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS                                =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	ratio9_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS                                               /                                                                1.0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001                                +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	(ratio28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ                                               >                                                                3.9999999999999999999999999999)                                ;
+ count100_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                               (count100_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_                                                                +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count103_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqr	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	*                                               00000000000000000000000000000000000000000000000000000000000000000000000000472909L                                                                -	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count105_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	%                                               1000003                                                                ;
+	 count101_abcdefghi                                               =                                                                (count101_abcdefghi	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                                                                                    count110_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ                                               *                                                                0000000000000000000000000000000000000000000000000000000000000000000000000000000000000577638L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	-                                                                                                    count118_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJK)                                               %                                                                1000003	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+       matches                                                                =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	matches                                                                                                    + (text12_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ                                                                ==	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	text2_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ)                                                                                                    + ("KLMNOPQ\tRSTUVWXYZ_0123456789_abcdefghijkl\"n"                                                                ==	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	text12_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ)                                                                                                    ;
+               count103_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqr	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                                                                                    (count103_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqr +	 count4_abcdefghijklmnopqrstuv	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	*                                                                                                    00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000787096L -	 count24_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMN)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	%                                                                                                    1000003 ;
+	 	 	 	 	 	 	 	 ratio14_abcdefghijklmno                                                                                                    = ratio14_abcdefghijklmno	 /       1.00000000000000000000000000001                                                                                                    + (ratio13_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq	 >       3.9999999999999999999999999999999999999999999)                                                                                                    ;
+                 count105_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ =	 (count105_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ       +               count18_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234 *	 000000000000000996554L       -               count50_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOP) %	 1000003       ;
+                               count106_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghi	 =       (count106_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghi               +	 	 	 	 	 	 	 	 count25_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm	 *       000000000000000000000000001101283L               -	 	 	 	 	 	 	 	 count63_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQ)	 %       1000003               ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 matches       =               matches	 	 	 	 	 	 	 	 +                 (text17_abcdefg       ==               text27_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012)	 	 	 	 	 	 	 	 +                 ("PQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghi"       ==               text17_abcdefg)	 	 	 	 	 	 	 	 ;
+                                 count108_abcdefghijklmnopqrstuvwxyz_A               =	 	 	 	 	 	 	 	 (count108_abcdefghijklmnopqrstuvwxyz_A                 +                               count39               *	 	 	 	 	 	 	 	 0000000000000000000000000000000000000000000000001310741L                 -                               count89_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS)               %	 	 	 	 	 	 	 	 1000003                 ;
+                                               ratio19_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM	 	 	 	 	 	 	 	 =                 ratio19_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM                               /	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 1.0000000000000000000000000000000000000000000000000000000000000001	 	 	 	 	 	 	 	 +                 (ratio28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ                               >	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 3.9999999999999999999999999999999999999999999999999999999999)	 	 	 	 	 	 	 	 ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count110_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ                 =                               (count110_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 +                                 count53_abcdefghijklmnopqrstuvwxyz_ABCDEFG                 *                               00000000000000000000000000000000000000000000000000000000000000000000001520199L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 -                                 count115_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRST)                 %                               1000003	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+                                                                 count111_abcdefghijklmnopqrs                               =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 (count111_abcdefghijklmnopqrs                                 +                                               count60_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ                               *	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 0000000000000000000000000000000000000000000000000000000000000000000000000000000001624928L                                 -                                               count8_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVW)                               %	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 1000003                                 ;
+                                                                                                    matches	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 =                                 matches                                               +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 (text22_abcdefghijklmnopqrstuvwxyz_ABCDE	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ==                                 text22_abcdefghijklmnopqrstuvwxyz_ABCDE)                                               +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ("UVWXYZ_0123456789_abcdefghijklmn"	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ==                                 text22_abcdefghijklmnopqrstuvwxyz_ABCDE)                                               ;
+	count113_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_A                                 =                                               (count113_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_A	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 +                                                                 count74_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz                                 *                                               00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001834386L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 -                                                                 count34_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWX)                                 %                                               1000003	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+  ratio24_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_                                               =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ratio24_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_                                                                 /                                                                                                    1.000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001                                               +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 (ratio13_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq                                                                 >                                                                                                    3.9999999999999999999999999999999999999999999999999999999999999999999999999)                                               ;
+       count115_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRST	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 =                                                                 (count115_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRST                                                                                                    +	count88_abcdefghi	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 *                                                                 000000000002043844L                                                                                                    -	count60_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 %                                                                 1000003                                                                                                    ;
+	 	 	 	 	 	 	 	count116_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrs                                                                 =                                                                                                    (count116_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrs	+  count95_abcdefghijklmnopqrstuvwxyz_A                                                                 *                                                                                                    00000000000000000000002148573L	-  count73_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_)                                                                 %                                                                                                    1000003	;
+                matches                                                                                                    =	matches  +       (text27_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012                                                                                                    ==	text17_abcdefg)  +       ("Z_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789\t_abcdefg\"i"                                                                                                    ==	text27_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012)  ;
+                 count118_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJK	=  (count118_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJK       +	 	 	 	 	 	 	 	count109_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_	*  000000000000000000000000000000000000000000002358031L       -	 	 	 	 	 	 	 	count99_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01)	%  1000003       ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	ratio29_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxy  =       ratio29_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxy	 	 	 	 	 	 	 	/                1.0000000000000000000000000000000001  +       (ratio28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ	 	 	 	 	 	 	 	>                3.9999999999999999999999999999999999999999999999999999999999999999999999999999999999999999)  ;
+                                count0       =	 	 	 	 	 	 	 	(count0                +                 count3_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM       *	 	 	 	 	 	 	 	0000000000000000000000000000000000000000000000000000000000000000002567489L                -                 count5_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234)       %	 	 	 	 	 	 	 	1000003                ;
+                                 count1_abcdefghijklmnopqrstuvwxyz_ABCD	 	 	 	 	 	 	 	=                (count1_abcdefghijklmnopqrstuvwxyz_ABCD                 +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count10_abc	 	 	 	 	 	 	 	*                000000000000000000000000000000000000000000000000000000000000000000000000000002672218L                 -	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count18_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234)	 	 	 	 	 	 	 	%                1000003                 ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	matches                =                 matches	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                (text2_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ                ==                 text12_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                ("3456789_abcdefghijklmn"                ==                 text2_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+                                                                count3_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	(count3_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM                                +                                 count24_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMN                 *	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002881676L                                -                                 count44_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456)                 %	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	1000003                                ;
+                                                                 ratio4_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstu	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                ratio4_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstu                                 /	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	1.000000000000000000000000000000000000000000000000000000000000000000001	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                (ratio13_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq                                 >	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	3.9999999999999)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count5_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234                                =                                 (count5_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                                                count38_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmn                                *                                 00000003091134L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	-                                                                count70_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012345678)                                %                                 1000003	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+ count6_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCD                                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	(count6_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCD                                                                +                                                                 count45_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEF                                 *	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	0000000000000000003195863L                                                                -                                                                 count83_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789)                                 %	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	1000003                                                                ;
+  matches	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                                                matches                                                                 +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 (text7_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	==                                                                text7_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm)                                                                 +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ("89_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghi"	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	==                                                                text7_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm)                                                                 ;
+	 	 	 	count8_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVW                                                                =                                                                 (count8_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVW	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 + count59_abcdefghijklmnop                                                                *                                                                 00000000000000000000000000000000000000003405321L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 - count109_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_)                                                                %                                                                 1000003	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ;
+               ratio9_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS                                                                 =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ratio9_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS /  1.0001                                                                 +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 (ratio28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ >  3.9999999999999999999999999999)                                                                 ;
+                count10_abc	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 = (count10_abc  +	 	 	 	count73_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 * 000000000000000000000000000000000000000000000000000000000000003614779L  -	 	 	 	count15_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abc)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 % 1000003  ;
+	 	 	 	 	 	 	 	 	count11_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM =  (count11_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM	 	 	 	+               count80_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefgh *  00000000000000000000000000000000000000000000000000000000000000000000000003719508L	 	 	 	-               count28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcd) %  1000003	 	 	 	;
+                               matches  =	 	 	 	matches               +                (text12_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ  ==	 	 	 	text2_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ)               +                ("cdefghi\tjkl\"n"  ==	 	 	 	text12_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ)               ;
+                                count13	 	 	 	=               (count13                +	 	 	 	 	 	 	 	 	count94_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS	 	 	 	*               000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003928966L                -	 	 	 	 	 	 	 	 	count54_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdef)	 	 	 	%               1000003                ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	ratio14_abcdefghijklmno               =                ratio14_abcdefghijklmno	 	 	 	 	 	 	 	 	/                               1.000000000000000000000000000000000000001               +                (ratio13_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq	 	 	 	 	 	 	 	 	>                               3.9999999999999999999999999999999999999999999)               ;
+                                               count15_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abc                =	 	 	 	 	 	 	 	 	(count15_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abc                               +                                count108_abcdefghijklmnopqrstuvwxyz_A                *	 	 	 	 	 	 	 	 	0004138424L                               -                                count80_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefgh)                %	 	 	 	 	 	 	 	 	1000003                               ;
+                                                                count16_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM	 	 	 	 	 	 	 	 	=                               (count16_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM                                +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count115_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRST	 	 	 	 	 	 	 	 	*                               000000000000004243153L                                -	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count93_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghi)	 	 	 	 	 	 	 	 	%                               1000003                                ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	matches                               =                                matches	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                               (text17_abcdefg                               ==                                text27_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                               ("hijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghi"                               ==                                text17_abcdefg)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+                                                                                                    count18_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234                                =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	(count18_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234                                               +                                                                count9_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuv                                *	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	0000000000000000000000000000000000004452611L                                               -                                                                count119_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghij)                                %	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	1000003                                               ;
+ ratio19_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                               ratio19_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM                                                                /	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	1.00000000000000000000000000000000000000000000000000000000000000000000000001	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                               (ratio28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ                                                                >	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	3.9999999999999999999999999999999999999999999999999999999999)	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+	 count20_abcdefghijklm                                               =                                                                (count20_abcdefghijklm	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	+                                                                                                    count23_abcd                                               *                                                                00000000000000000000000000000000000000000000000000000000004662069L	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	-                                                                                                    count25_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm)                                               %                                                                1000003	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	;
+       count21_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVW                                                                =	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	(count21_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVW                                                                                                    + count30_abcdefghijklmnopqrstuvw                                                                *	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	0000000000000000000000000000000000000000000000000000000000000000000004766798L                                                                                                    - count38_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmn)                                                                %	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	1000003                                                                                                    ;
+               matches	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	=                                                                                                    matches +	 (text22_abcdefghijklmnopqrstuvwxyz_ABCDE	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	==                                                                                                    text22_abcdefghijklmnopqrstuvwxyz_ABCDE) +	 ("mn"	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	==                                                                                                    text22_abcdefghijklmnopqrstuvwxyz_ABCDE) ;
+	 	 	 	 	 	 	 	 count23_abcd                                                                                                    = (count23_abcd	 +       count44_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456                                                                                                    * 00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000004976256L	 -       count64_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnop)                                                                                                    % 1000003	 ;
+                 ratio24_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_ =	 ratio24_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_       /               1.000000001 +	 (ratio13_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq       >               3.9999999999999999999999999999999999999999999999999999999999999999999999999) ;
+                               count25_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm	 =       (count25_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm               +	 	 	 	 	 	 	 	 count58_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFG	 *       000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000005185714L               -	 	 	 	 	 	 	 	 count90_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqr)	 %       1000003               ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count26       =               (count26	 	 	 	 	 	 	 	 +                 count65       *               00000000005290443L	 	 	 	 	 	 	 	 -                 count103_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqr)       %               1000003	 	 	 	 	 	 	 	 ;
+                                 matches               =	 	 	 	 	 	 	 	 matches                 +                               (text27_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012               ==	 	 	 	 	 	 	 	 text17_abcdefg)                 +                               ("rstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234\t56789_abcdefg\"i"               ==	 	 	 	 	 	 	 	 text27_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012)                 ;
+                                               count28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcd	 	 	 	 	 	 	 	 =                 (count28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcd                               +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count79_abcdefghijklmnopqrstuvwxyz_ABCDEFGHI	 	 	 	 	 	 	 	 *                 000000000000000000000000000000005499901L                               -	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count9_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuv)	 	 	 	 	 	 	 	 %                 1000003                               ;
+	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 ratio29_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxy                 =                               ratio29_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxy	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 /                                 1.00000000000000000000000000000000000000000001                 +                               (ratio28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 >                                 3.9999999999999999999999999999999999999999999999999999999999999999999999999999999999999999)                 ;
+    round = round + 1;
+    if round < 100, { exec work; };
+};
+##exec work;
+##print "counters 0 to 9: ", (count0 + count1_abcdefghijklmnopqrstuvwxyz_ABCD + count2_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abc + count3_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM + count4_abcdefghijklmnopqrstuv + count5_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234 + count6_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCD + count7_abcdefghijklm + count8_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVW + count9_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuv), "\n";
+##print "counters 10 to 19: ", (count10_abc +                                                                count11_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM +                                                                count12_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijkl +                                                                count13 +                                                                count14_abcdefghijklmnopqrstuvwxyz_ABCD +                                                                count15_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abc +                                                                count16_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM +                                                                count17_abcdefghijklmnopqrstuv +                                                                count18_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234 +                                                                count19_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCD), "\n";
+##print "counters 20 to 29: ", (count20_abcdefghijklm +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count21_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVW +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count22_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuv +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count23_abcd +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count24_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMN +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count25_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklm +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count26 +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count27_abcdefghijklmnopqrstuvwxyz_ABCDE +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcd +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 count29_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMN), "\n";
+##print "counters 30 to 39: ", (count30_abcdefghijklmnopqrstuvw +                count31_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012345 +                count32_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDE +                count33_abcdefghijklmn +                count34_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWX +                count35_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvw +                count36_abcde +                count37_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNO +                count38_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmn +                count39), "\n";
+##print "counters 40 to 49: ", (count40_abcdefghijklmnopqrstuvwxyz_ABCDEF +  count41_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcde +  count42_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNO +  count43_abcdefghijklmnopqrstuvwx +  count44_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456 +  count45_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEF +  count46_abcdefghijklmno +  count47_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXY +  count48_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwx +  count49_abcdef), "\n";
+##print "counters 50 to 59: ", (count50_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOP +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count51_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmno +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count52 +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count53_abcdefghijklmnopqrstuvwxyz_ABCDEFG +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count54_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdef +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count55_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOP +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count56_abcdefghijklmnopqrstuvwxy +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count57_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01234567 +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count58_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFG +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count59_abcdefghijklmnop), "\n";
+##print "counters 60 to 69: ", (count60_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ +                                 count61_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxy +                                 count62_abcdefg +                                 count63_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQ +                                 count64_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnop +                                 count65 +                                 count66_abcdefghijklmnopqrstuvwxyz_ABCDEFGH +                                 count67_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefg +                                 count68_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQ +                                 count69_abcdefghijklmnopqrstuvwxyz), "\n";
+##print "counters 70 to 79: ", (count70_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012345678 +                 count71_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGH +                 count72_abcdefghijklmnopq +                 count73_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_ +                 count74_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz +                 count75_abcdefgh +                 count76_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQR +                 count77_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq +                 count78 +                 count79_abcdefghijklmnopqrstuvwxyz_ABCDEFGHI), "\n";
+##print "counters 80 to 89: ", (count80_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefgh +	 	 	 	count81_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQR +	 	 	 	count82_abcdefghijklmnopqrstuvwxyz_ +	 	 	 	count83_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789 +	 	 	 	count84_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHI +	 	 	 	count85_abcdefghijklmnopqr +	 	 	 	count86_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0 +	 	 	 	count87_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ +	 	 	 	count88_abcdefghi +	 	 	 	count89_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS), "\n";
+##print "counters 90 to 99: ", (count90_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqr +                                                                                                    count91_ +                                                                                                    count92_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ +                                                                                                    count93_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghi +                                                                                                    count94_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS +                                                                                                    count95_abcdefghijklmnopqrstuvwxyz_A +                                                                                                    count96_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_ +                                                                                                    count97_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ +                                                                                                    count98_abcdefghijklmnopqrs +                                                                                                    count99_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01), "\n";
+##print "counters 100 to 109: ", (count100_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ +                                               count101_abcdefghi +                                               count102_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS +                                               count103_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqr +                                               count104_ +                                               count105_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ +                                               count106_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghi +                                               count107_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS +                                               count108_abcdefghijklmnopqrstuvwxyz_A +                                               count109_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_), "\n";
+##print "counters 110 to 119: ", (count110_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count111_abcdefghijklmnopqrs +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count112_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_01 +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count113_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_A +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count114_abcdefghij +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count115_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRST +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count116_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrs +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count117_a +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count118_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJK +	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	count119_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghij), "\n";
+##print "ratios over 2: ", ((ratio0 > 2) + (ratio1_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRST > 2) + (ratio2_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGH > 2) + (ratio3_abcdefghijklmnopqrstuvwxyz_ABCDEF > 2) + (ratio4_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstu > 2) + (ratio5_abcdefghijklmnopqrs > 2) + (ratio6_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefg > 2) + (ratio7_abcde > 2) + (ratio8_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123 > 2) + (ratio9_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRS > 2) + (ratio10_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOP > 2) + (ratio11_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCD > 2) + (ratio12_abcdefghijklmnopqrstuvwxyz_AB > 2) + (ratio13_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq > 2) + (ratio14_abcdefghijklmno > 2) + (ratio15_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abc > 2) + (ratio16_a > 2) + (ratio17_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_ > 2) + (ratio18_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNO > 2) + (ratio19_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLM > 2) + (ratio20_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_A > 2) + (ratio21_abcdefghijklmnopqrstuvwxyz > 2) + (ratio22_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmn > 2) + (ratio23_abcdefghijkl > 2) + (ratio24_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_ > 2) + (ratio25 > 2) + (ratio26_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWX > 2) + (ratio27_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKL > 2) + (ratio28_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ > 2) + (ratio29_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopqrstuvwxy > 2)), "\n";
+##print "string matches: ", matches, "\n";
+##print "text3_abcdef: ", text3_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefghijklmnopq, "\n";
+##print "text11_abcde: ", text11_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_abcdefgh, "\n";
+##print "text19_abcde: ", text19_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_, "\n";
+##print "text27_abcde: ", text27_abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_012, "\n";
@@ -0,0 +1,221 @@
+Tokenizer benchmark: identifiers, numbers, whitespace runs and string literals from 1 to 120 characters long, so runs end both in the vector scanners and in their scalar tails, then a block of them run 100 times
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+counters 0 to 9: 3868376
+
+counters 10 to 19: 3671973
+
+counters 20 to 29: 3238592
+
+counters 30 to 39: 4887930
+
+counters 40 to 49: 4680006
+
+counters 50 to 59: 5127325
+
+counters 60 to 69: 4735034
+
+counters 70 to 79: 6138966
+
+counters 80 to 89: 4768826
+
+counters 90 to 99: 5489742
+
+counters 100 to 109: 5976752
+
+counters 110 to 119: 6898425
+
+ratios over 2: 21
+
+string matches: 1000
+
+text3_abcdef: def
+
+text11_abcde: lmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789_a	bcdefghijklmnopqrstuvwxyz_ABCDEFGH"J
+
+text19_abcde: tuvwxyz_ABCDEFGHIJKL	MNOPQRSTUVWXYZ_0123456789_abcdefghijk"m
+
+text27_abcde: AB	CDEFGHIJKLMNOPQRSTUVWXY"_
+